@@ -0,0 +1,54 @@
+#ifndef OTER_ALIGNEDALLOCATOR_HPP
+#define OTER_ALIGNEDALLOCATOR_HPP
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+#include <OtterML/Common.hpp>
+
+namespace oter
+{
+
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+/**
+* \brief Allocator that aligns every allocation to \p Alignment bytes, so ranges of an array can be split on cache line boundaries.
+*/
+template <typename T, size_t Alignment = CACHE_LINE_SIZE>
+struct AlignedAllocator
+{
+public:
+	using value_type = T;
+
+	template <typename U>
+	struct rebind
+	{
+		using other = AlignedAllocator<U, Alignment>;
+	};
+
+	AlignedAllocator() = default;
+
+	template <typename U>
+	AlignedAllocator(const AlignedAllocator<U, Alignment>&) { }
+
+	[[nodiscard]] T* allocate(const size_t count)
+	{
+		return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+	}
+
+	void deallocate(T* pointer, const size_t count)
+	{
+		::operator delete(pointer, count * sizeof(T), std::align_val_t(Alignment));
+	}
+
+	template <typename U>
+	friend bool operator==(const AlignedAllocator&, const AlignedAllocator<U, Alignment>&) { return true; }
+};
+
+template <typename T>
+using CacheAlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+}
+
+#endif
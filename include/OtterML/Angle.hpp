@@ -65,7 +65,8 @@ private:
 
 Angle operator""_d(long double value);
 
-constexpr Angle::Angle(f32 degrees) : _degrees(degrees) { }
+constexpr Angle::Angle() : _degrees(0.f) { }
+constexpr Angle::Angle(f32 degrees) : _degrees(degrees), _radians(static_cast<f32>(degrees * (PI / 180.0))) { }
 
 [[nodiscard]] constexpr f32 Angle::GetDegrees() const { return this->_degrees; }
 [[nodiscard]] constexpr f32 Angle::GetRadians() const	{ return this->_radians; }
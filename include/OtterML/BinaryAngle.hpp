@@ -0,0 +1,141 @@
+#ifndef OTER_BINARYANGLE_HPP
+#define OTER_BINARYANGLE_HPP
+
+#include <array>
+#include <cmath>
+#include <type_traits>
+
+#include <OtterML/Angle.hpp>
+
+namespace oter
+{
+
+constexpr u32 BINARY_ANGLE_TABLE_BITS = 12;
+constexpr u32 BINARY_ANGLE_TABLE_SIZE = 1u << BINARY_ANGLE_TABLE_BITS;
+
+/**
+* \brief Sine of a full turn split into BINARY_ANGLE_TABLE_SIZE steps, plus one extra entry so interpolation never wraps.
+*
+* Generated at compile time, so the values are identical on every platform.
+*/
+extern const std::array<f32, BINARY_ANGLE_TABLE_SIZE + 1> BINARY_ANGLE_SINE_TABLE;
+
+/**
+* \brief Represents an angle as a fraction of a full turn stored in an unsigned integer (binary angle measurement).
+*
+* The full range of T maps to one turn, so wrapping is free through integer overflow and all arithmetic is exact.
+* Sine and cosine are a table lookup plus linear interpolation (max error ~4e-7), which keeps them deterministic for replays and lockstep.
+*/
+template <typename T>
+struct BinaryAngle
+{
+	static_assert(std::is_same_v<T, u16> || std::is_same_v<T, u32>, "oter::BinaryAngle only supports u16 and u32.");
+
+public:
+	static constexpr u32 BITS      = sizeof(T) * 8;
+	static constexpr T   HALF_TURN = static_cast<T>(static_cast<T>(1) << (BITS - 1));
+	static constexpr T   QUARTER   = static_cast<T>(static_cast<T>(1) << (BITS - 2));
+
+	T Value = static_cast<T>(0);
+
+	constexpr BinaryAngle() = default;
+	constexpr explicit BinaryAngle(const T value) : Value(value) { }
+	explicit BinaryAngle(const Angle& angle) : BinaryAngle(FromDegrees(angle.GetDegrees())) { }
+
+	/**
+	* \brief Converts any number of degrees, including negative and multi-turn values, into the matching binary angle.
+	*/
+	static BinaryAngle FromDegrees(const f32 degrees)  { return FromTurns(static_cast<f64>(degrees) / 360.0); }
+	static BinaryAngle FromRadians(const f32 radians)  { return FromTurns(static_cast<f64>(radians) / (2.0 * PI)); }
+
+	[[nodiscard]] constexpr f32 GetTurns() const         { return static_cast<f32>(static_cast<f64>(this->Value) / TURN); }
+	[[nodiscard]] constexpr f32 GetDegrees() const       { return static_cast<f32>(static_cast<f64>(this->Value) * (360.0 / TURN)); }
+	[[nodiscard]] constexpr f32 GetRadians() const       { return static_cast<f32>(static_cast<f64>(this->Value) * (2.0 * PI / TURN)); }
+	[[nodiscard]] constexpr f32 GetSignedDegrees() const { return static_cast<f32>(static_cast<f64>(this->GetSigned()) * (360.0 / TURN)); }
+
+	[[nodiscard]] Angle ToAngle() const { return Angle(this->GetDegrees()); }
+
+	[[nodiscard]] f32 Sin() const { return Lookup(this->Value); }
+	[[nodiscard]] f32 Cos() const { return Lookup(static_cast<T>(this->Value + QUARTER)); }
+
+	void SinCos(f32& sine, f32& cosine) const
+	{
+		sine   = this->Sin();
+		cosine = this->Cos();
+	}
+
+	friend constexpr bool operator==(const BinaryAngle& left, const BinaryAngle& right) { return left.Value == right.Value; }
+	friend constexpr bool operator!=(const BinaryAngle& left, const BinaryAngle& right) { return !(left == right); }
+
+	// Binary angle operators
+	constexpr BinaryAngle& operator+=(const BinaryAngle& right)
+	{
+		this->Value = static_cast<T>(this->Value + right.Value);
+		return *this;
+	}
+	constexpr BinaryAngle& operator-=(const BinaryAngle& right)
+	{
+		this->Value = static_cast<T>(this->Value - right.Value);
+		return *this;
+	}
+
+	// Binary integer operators
+	constexpr BinaryAngle& operator*=(const i32 right)
+	{
+		this->Value = static_cast<T>(static_cast<u32>(this->Value) * static_cast<u32>(right));
+		return *this;
+	}
+
+	// Friend operators
+	friend constexpr BinaryAngle operator-(const BinaryAngle& right) { return BinaryAngle(static_cast<T>(0u - right.Value)); }
+
+	friend constexpr BinaryAngle operator+(BinaryAngle left, const BinaryAngle& right) { return left += right; }
+	friend constexpr BinaryAngle operator-(BinaryAngle left, const BinaryAngle& right) { return left -= right; }
+	friend constexpr BinaryAngle operator*(BinaryAngle left, const i32 right)          { return left *= right; }
+
+	/**
+	* \brief Interpolates along the shortest arc from \p from to \p to.
+	*/
+	static BinaryAngle Lerp(const BinaryAngle& from, const BinaryAngle& to, const f32 alpha)
+	{
+		const f64 delta = static_cast<f64>((to - from).GetSigned());
+		return from + BinaryAngle(static_cast<T>(static_cast<i64>(delta * alpha)));
+	}
+
+	static const BinaryAngle Zero;
+
+private:
+	static constexpr f64 TURN       = static_cast<f64>(1ull << BITS);
+	static constexpr u32 FRACT_BITS = BITS - BINARY_ANGLE_TABLE_BITS;
+
+	// Reinterprets the value as the range [-half turn, half turn)
+	[[nodiscard]] constexpr std::make_signed_t<T> GetSigned() const { return static_cast<std::make_signed_t<T>>(this->Value); }
+
+	static BinaryAngle FromTurns(const f64 turns)
+	{
+		const f64 fraction = turns - std::floor(turns);
+		return BinaryAngle(static_cast<T>(static_cast<u64>(fraction * TURN + 0.5)));
+	}
+
+	static f32 Lookup(const T value)
+	{
+		constexpr f32 fractScale = 1.f / static_cast<f32>(1u << FRACT_BITS);
+
+		const u32 index    = static_cast<u32>(value >> FRACT_BITS);
+		const f32 fraction = static_cast<f32>(value & ((1u << FRACT_BITS) - 1u)) * fractScale;
+
+		const f32 a = BINARY_ANGLE_SINE_TABLE[index];
+		const f32 b = BINARY_ANGLE_SINE_TABLE[index + 1];
+		return a + (b - a) * fraction;
+	}
+};
+
+template <typename T>
+const BinaryAngle<T> BinaryAngle<T>::Zero(static_cast<T>(0));
+
+using BinaryAngle16 = BinaryAngle<u16>;
+using BinaryAngle32 = BinaryAngle<u32>;
+
+}
+
+#endif
@@ -1,5 +1,5 @@
 #ifndef OTER_COLOR_HPP
-#define OTER_COLO_HPP
+#define OTER_COLOR_HPP
 
 #include <OtterML/Common.hpp>
 
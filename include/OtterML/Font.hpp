@@ -0,0 +1,108 @@
+#ifndef OTER_FONT_HPP
+#define OTER_FONT_HPP
+
+#include <string>
+#include <vector>
+
+#include <OtterML/Vector2.hpp>
+
+namespace oter
+{
+
+/**
+* \brief 8-bit coverage of one rasterized glyph, rows top to bottom.
+*
+* Offset is where the top-left corner of the bitmap goes relative to the pen position on the baseline, with y growing
+* downward.
+*/
+struct GlyphBitmap
+{
+public:
+	Vector2<u32>    Size   = Vector2<u32>(0u);
+	Vector2<i32>    Offset = Vector2<i32>(0);
+	std::vector<u8> Coverage;
+};
+
+/**
+* \brief TrueType font: maps characters to glyphs, provides metrics and kerning, and rasterizes glyph outlines.
+*
+* Reads the cmap (formats 4 and 12), hmtx, legacy kern and glyf tables of a TrueType font or the first font of a
+* collection. Outlines, composite glyphs included, are flattened to lines and rasterized with exact area coverage, so
+* edges are antialiased without supersampling. Hinting and CFF (.otf) outlines are not supported.
+*
+* Metrics are in font units; multiply them by GetScale() for pixels.
+*/
+class Font
+{
+public:
+	Font();
+	~Font();
+
+	/**
+	* \brief Throws std::runtime_error if the file cannot be read or is not a TrueType font.
+	*/
+	void LoadFromFile(const std::string& path);
+	void LoadFromMemory(std::vector<u8> data);
+
+	/**
+	* \brief Glyph for Unicode \p codepoint, or 0 (the missing-glyph box) if the font has none.
+	*/
+	[[nodiscard]] u32 GetGlyphIndex(u32 codepoint) const;
+	[[nodiscard]] i32 GetAdvance(u32 glyph) const;
+	[[nodiscard]] i32 GetKerning(u32 left, u32 right) const;
+
+	[[nodiscard]] i32 GetAscender() const;
+	[[nodiscard]] i32 GetDescender() const;
+	[[nodiscard]] i32 GetLineGap() const;
+	[[nodiscard]] u32 GetGlyphCount() const;
+
+	/**
+	* \brief Font units to pixels, so that the distance from the highest ascender to the lowest descender is \p pixelHeight.
+	*/
+	[[nodiscard]] f32 GetScale(f32 pixelHeight) const;
+
+	[[nodiscard]] GlyphBitmap Rasterize(u32 glyph, f32 pixelHeight) const;
+
+private:
+	struct Point
+	{
+	public:
+		f32 x;
+		f32 y;
+	};
+
+	std::vector<u8> _data;
+
+	u32  _glyf         = 0;
+	u32  _loca         = 0;
+	u32  _hmtx         = 0;
+	u32  _kernPairs    = 0;
+	u32  _kernCount    = 0;
+	u32  _cmap         = 0;
+	u32  _glyphCount   = 0;
+	u32  _hMetricCount = 0;
+	bool _longLoca     = false;
+
+	i32 _ascender  = 0;
+	i32 _descender = 0;
+	i32 _lineGap   = 0;
+
+	u32  FindTable(u32 fontOffset, const char* tag, u32* length = nullptr) const;
+	void ReadCMap(u32 offset);
+	void ReadKern(u32 offset, u32 length);
+
+	bool GetGlyphRange(u32 glyph, u32& offset, u32& length) const;
+
+	// Appends the glyph's outline, transformed, as closed polylines; contourEnds holds one past each contour's last point
+	void AppendOutline(u32 glyph, const f32 transform[6], f32 tolerance, std::vector<Point>& points,
+	                   std::vector<u32>& contourEnds, u32 depth) const;
+
+	u8  ReadU8(size_t offset) const;
+	u16 ReadU16(size_t offset) const;
+	i16 ReadI16(size_t offset) const;
+	u32 ReadU32(size_t offset) const;
+};
+
+}
+
+#endif
@@ -0,0 +1,127 @@
+#ifndef OTER_FRAMEBUFFER_HPP
+#define OTER_FRAMEBUFFER_HPP
+
+#include <memory>
+#include <vector>
+
+#include <OtterML/Texture2D.hpp>
+
+namespace oter
+{
+
+/**
+* \brief Size and formats a FrameBuffer is created with. \p Samples above 1 renders into multisampled renderbuffers
+* that Resolve() blits into the textures.
+*/
+struct FrameBufferFormat
+{
+public:
+	Vector2<u32>  Size        = Vector2<u32>(0u);
+	TextureFormat ColorFormat = TextureFormat::RGBA8;
+	bool          HasDepth    = false;
+	TextureFormat DepthFormat = TextureFormat::Depth24Stencil8;
+	u32           Samples     = 1;
+
+	friend bool operator==(const FrameBufferFormat& left, const FrameBufferFormat& right);
+};
+
+/**
+* \brief Render target whose color, and optionally depth, end up in Texture2Ds that later passes can sample.
+*
+* With multisampling, drawing goes to renderbuffers on a separate framebuffer, and Resolve() blits them into the
+* textures. Resolve() does nothing when nothing was drawn since the last resolve, so it is cheap to call before every read.
+*/
+class FrameBuffer
+{
+public:
+	FrameBuffer();
+	~FrameBuffer();
+
+	FrameBuffer(const FrameBuffer&)            = delete;
+	FrameBuffer& operator=(const FrameBuffer&) = delete;
+
+	void Init(const FrameBufferFormat& format);
+	void Delete();
+
+	/**
+	* \brief Binds the framebuffer for drawing and sets the viewport to its size.
+	*/
+	void Bind();
+
+	/**
+	* \brief Binds the window's framebuffer for drawing and sets the viewport to \p size.
+	*/
+	static void BindDefault(const Vector2<u32>& size);
+
+	/**
+	* \brief Copies the multisampled renderbuffers into the textures. The draw and read framebuffer bindings are left as they
+	* were.
+	*/
+	void Resolve();
+
+	[[nodiscard]] const Texture2D&         GetColorTexture() const;
+	[[nodiscard]] const Texture2D&         GetDepthTexture() const;
+	[[nodiscard]] const FrameBufferFormat& GetFormat() const;
+	[[nodiscard]] const Vector2<u32>&      GetSize() const;
+	[[nodiscard]] u32                      GetID() const;
+
+private:
+	FrameBufferFormat _format;
+
+	// Single-sampled framebuffer with the texture attachments
+	u32       _id = 0;
+	Texture2D _color;
+	Texture2D _depth;
+
+	// Multisampled framebuffer drawn into when Samples > 1
+	u32 _multisampleID    = 0;
+	u32 _multisampleColor = 0;
+	u32 _multisampleDepth = 0;
+
+	bool _needsResolve = false;
+
+	static void CheckStatus();
+};
+
+/**
+* \brief Hands out FrameBuffers and takes them back for reuse, so post-processing chains stop creating GL objects once
+* every format they need has been created once.
+*/
+class FrameBufferPool
+{
+public:
+	FrameBufferPool();
+	~FrameBufferPool();
+
+	/**
+	* \brief Returns a free FrameBuffer with exactly \p format, creating one only if none is free.
+	*/
+	FrameBuffer& Acquire(const FrameBufferFormat& format);
+
+	/**
+	* \brief Returns \p frameBuffer to the pool. Its contents are kept until it is acquired again.
+	*/
+	void Release(const FrameBuffer& frameBuffer);
+
+	/**
+	* \brief Deletes every pooled FrameBuffer. All acquired ones must have been released.
+	*/
+	void Clear();
+
+	[[nodiscard]] u32 GetCount() const;
+	[[nodiscard]] u32 GetFreeCount() const;
+
+private:
+	struct Entry
+	{
+	public:
+		std::unique_ptr<FrameBuffer> frameBuffer;
+		bool                         inUse;
+	};
+
+	std::vector<Entry> _entries;
+};
+
+}
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef OTER_FULLSCREENPASS_HPP
+#define OTER_FULLSCREENPASS_HPP
+
+#include <OtterML/Common.hpp>
+
+namespace oter
+{
+class Shader;
+class Texture2D;
+
+/**
+* \brief Draws one triangle that covers the whole viewport, for presenting framebuffers and post-processing.
+*
+* The vertex shader derives the corners from gl_VertexID, so no vertex data exists. The only GL object is one empty
+* vertex array, created in Init() and shared by every pass, since core profiles refuse to draw without one bound.
+* Shaders should use VERTEX_SOURCE, which passes vTexCoord to the fragment stage, and read the source from the
+* sampler2D uniform uSource. FRAGMENT_SOURCE is a plain copy.
+*/
+class FullscreenPass
+{
+public:
+	static const char* const VERTEX_SOURCE;
+	static const char* const FRAGMENT_SOURCE;
+
+	FullscreenPass();
+	~FullscreenPass();
+
+	void Init();
+	void Delete();
+
+	/**
+	* \brief Draws with whatever textures are currently bound.
+	*/
+	void Draw(const Shader& shader) const;
+
+	/**
+	* \brief Binds \p source to unit 0 and points the shader's uSource at it before drawing.
+	*/
+	void Draw(const Texture2D& source, const Shader& shader) const;
+
+private:
+	u32 _vao = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef OTER_GLEXTENSIONS_HPP
+#define OTER_GLEXTENSIONS_HPP
+
+#include <glad/gl.h>
+
+#include <OtterML/Common.hpp>
+
+// Tokens from GL 4.4 / ARB_buffer_storage, which the bundled GL 4.1 loader does not define
+#ifndef GL_MAP_PERSISTENT_BIT
+	#define GL_MAP_PERSISTENT_BIT 0x0040
+#endif
+#ifndef GL_MAP_COHERENT_BIT
+	#define GL_MAP_COHERENT_BIT 0x0080
+#endif
+#ifndef GL_DYNAMIC_STORAGE_BIT
+	#define GL_DYNAMIC_STORAGE_BIT 0x0100
+#endif
+#ifndef GL_CLIENT_STORAGE_BIT
+	#define GL_CLIENT_STORAGE_BIT 0x0200
+#endif
+
+namespace oter
+{
+
+/**
+* \brief Entry points newer than the bundled GL 4.1 loader. Each one is null when the context does not support it.
+*/
+struct GLExtensionFunctions
+{
+public:
+	using BufferStorageFunc             = void (GLAD_API_PTR*)(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags);
+	using MultiDrawElementsIndirectFunc = void (GLAD_API_PTR*)(GLenum mode, GLenum type, const void* indirect, GLsizei drawCount, GLsizei stride);
+
+	BufferStorageFunc             BufferStorage             = nullptr;
+	MultiDrawElementsIndirectFunc MultiDrawElementsIndirect = nullptr;
+};
+
+extern GLExtensionFunctions GLExtensions;
+
+/**
+* \brief Loads the optional entry points in GLExtensions. Call after gladLoadGL, with the same context current.
+*/
+void LoadGLExtensions(GLADloadfunc load);
+
+/**
+* \brief Loads the core GL functions through glad, then the optional ones. Returns false if no GL context could be loaded.
+*/
+bool LoadGL(GLADloadfunc load);
+
+}
+
+#endif
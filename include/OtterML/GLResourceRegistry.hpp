@@ -0,0 +1,115 @@
+#ifndef OTER_GLRESOURCEREGISTRY_HPP
+#define OTER_GLRESOURCEREGISTRY_HPP
+
+#include <vector>
+
+#include <OtterML/Common.hpp>
+
+namespace oter
+{
+
+enum class GLResourceType : u8
+{
+	Buffer,
+	Texture,
+	Program,
+};
+
+/**
+* \brief Reference to a GL object in a GLResourceRegistry. Once the object is destroyed, its slot's generation moves on,
+* so old handles stop resolving instead of pointing at whatever reuses the slot.
+*/
+template <GLResourceType Type>
+struct GLHandle
+{
+public:
+	u32 Index      = UINT32_MAX;
+	u32 Generation = 0;
+
+	friend bool operator==(const GLHandle& left, const GLHandle& right) = default;
+};
+
+using BufferHandle  = GLHandle<GLResourceType::Buffer>;
+using TextureHandle = GLHandle<GLResourceType::Texture>;
+using ProgramHandle = GLHandle<GLResourceType::Program>;
+
+/**
+* \brief Owns GL buffers, textures and programs behind generational handles.
+*
+* Looking a handle up is an index into a dense array plus a generation compare. Destroy() invalidates the handle at once
+* but only queues the GL name, and FlushDeletions() deletes everything queued with one call per object type. Call it
+* once per frame, after the last draw that could still use the destroyed objects.
+*
+* The destructor does not touch GL, since the context may already be gone; call Clear() while it is still current.
+*/
+class GLResourceRegistry
+{
+public:
+	GLResourceRegistry();
+	~GLResourceRegistry();
+
+	GLResourceRegistry(const GLResourceRegistry&)            = delete;
+	GLResourceRegistry& operator=(const GLResourceRegistry&) = delete;
+
+	BufferHandle  CreateBuffer();
+	TextureHandle CreateTexture();
+
+	/**
+	* \brief Takes ownership of an existing GL object, such as a program linked by Shader::Compile().
+	*/
+	BufferHandle  RegisterBuffer(u32 name);
+	TextureHandle RegisterTexture(u32 name);
+	ProgramHandle RegisterProgram(u32 name);
+
+	void Destroy(BufferHandle handle);
+	void Destroy(TextureHandle handle);
+	void Destroy(ProgramHandle handle);
+
+	[[nodiscard]] bool IsValid(BufferHandle handle) const;
+	[[nodiscard]] bool IsValid(TextureHandle handle) const;
+	[[nodiscard]] bool IsValid(ProgramHandle handle) const;
+
+	/**
+	* \brief GL name behind \p handle, or 0 if the handle is stale.
+	*/
+	[[nodiscard]] u32 Get(BufferHandle handle) const;
+	[[nodiscard]] u32 Get(TextureHandle handle) const;
+	[[nodiscard]] u32 Get(ProgramHandle handle) const;
+
+	/**
+	* \brief Deletes every object destroyed since the last flush.
+	*/
+	void FlushDeletions();
+
+	/**
+	* \brief Destroys every object and flushes, invalidating all handles.
+	*/
+	void Clear();
+
+	[[nodiscard]] u32 GetLiveCount(GLResourceType type) const;
+	[[nodiscard]] u32 GetPendingDeletionCount() const;
+
+private:
+	struct SlotTable
+	{
+	public:
+		std::vector<u32> names;
+		std::vector<u32> generations;
+		std::vector<u32> freeSlots;
+		std::vector<u32> pendingDeletion;
+		u32              liveCount = 0;
+
+		u32  Add(u32 name);
+		bool IsValid(u32 index, u32 generation) const;
+		void Remove(u32 index, u32 generation);
+		void RemoveAll();
+	};
+
+	SlotTable _buffers;
+	SlotTable _textures;
+	SlotTable _programs;
+};
+
+}
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef OTER_GLSTATE_HPP
+#define OTER_GLSTATE_HPP
+
+#include <OtterML/Common.hpp>
+
+namespace oter
+{
+
+/**
+* \brief How many binds went through to GL and how many were skipped because the object was already bound.
+*/
+struct GLStateCounters
+{
+public:
+	u64 ProgramBinds       = 0;
+	u64 ProgramSkips       = 0;
+	u64 TextureBinds       = 0;
+	u64 TextureSkips       = 0;
+	u64 BufferBinds        = 0;
+	u64 BufferSkips        = 0;
+	u64 VertexArrayBinds   = 0;
+	u64 VertexArraySkips   = 0;
+	u64 FrameBufferBinds   = 0;
+	u64 FrameBufferSkips   = 0;
+	u64 ActiveTextureCalls = 0;
+	u64 ActiveTextureSkips = 0;
+
+	[[nodiscard]] u64 GetIssuedCount() const;
+	[[nodiscard]] u64 GetSkippedCount() const;
+};
+
+/**
+* \brief Shadow copy of the bindings of the GL context current on this thread, used to skip binds that change nothing.
+*
+* Every bind in OtterML goes through here. The shadow state is thread-local, matching GL's one-current-context-per-thread
+* rule. It starts out unknown, so the first bind of each kind always reaches GL. Code that binds objects behind
+* OtterML's back, or switches contexts on a thread, must call Invalidate() afterwards.
+*
+* The element array buffer binding belongs to the vertex array, so it is forgotten whenever the vertex array changes.
+* Buffer targets the cache does not track are passed straight through.
+*/
+class GLState
+{
+public:
+	GLState() = delete;
+
+	static void UseProgram(u32 program);
+	static void ActiveTexture(u32 unit);
+	static void BindTexture(u32 target, u32 texture);
+	static void BindBuffer(u32 target, u32 buffer);
+	static void BindVertexArray(u32 vertexArray);
+
+	/**
+	* \brief Binds to GL_DRAW_FRAMEBUFFER, GL_READ_FRAMEBUFFER, or both with GL_FRAMEBUFFER.
+	*/
+	static void BindFrameBuffer(u32 target, u32 frameBuffer);
+
+	/**
+	* \brief Framebuffer bound to GL_DRAW_FRAMEBUFFER or GL_READ_FRAMEBUFFER, asking GL only while the binding is unknown.
+	*/
+	[[nodiscard]] static u32 GetFrameBuffer(u32 target);
+
+	/**
+	* \brief Deletes the object and drops it from the shadow state, so a recycled name is not mistaken for the old object.
+	*/
+	static void DeleteProgram(u32 program);
+	static void DeleteTextures(u32 count, const u32* textures);
+	static void DeleteBuffers(u32 count, const u32* buffers);
+	static void DeleteVertexArrays(u32 count, const u32* vertexArrays);
+	static void DeleteFrameBuffers(u32 count, const u32* frameBuffers);
+
+	/**
+	* \brief Forgets every binding, so the next bind of each kind is issued to GL.
+	*/
+	static void Invalidate();
+
+	[[nodiscard]] static const GLStateCounters& GetCounters();
+	static void                                 ResetCounters();
+};
+
+}
+
+#endif
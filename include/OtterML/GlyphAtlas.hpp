@@ -0,0 +1,111 @@
+#ifndef OTER_GLYPHATLAS_HPP
+#define OTER_GLYPHATLAS_HPP
+
+#include <unordered_map>
+#include <vector>
+
+#include <OtterML/Texture2D.hpp>
+#include <OtterML/Vector2.hpp>
+
+namespace oter
+{
+class Font;
+
+/**
+* \brief Placement of one rasterized glyph in a GlyphAtlas, in pixels relative to the pen position on the baseline.
+*/
+struct AtlasGlyph
+{
+public:
+	Vector2<f32> UVPosition = Vector2<f32>(0.f);
+	Vector2<f32> UVSize     = Vector2<f32>(0.f);
+	Vector2<f32> Offset     = Vector2<f32>(0.f);
+	Vector2<f32> Size       = Vector2<f32>(0.f);
+};
+
+/**
+* \brief Texture that glyphs are rasterized into on first use, packed in shelves, for any mix of fonts and sizes.
+*
+* Glyphs are stored white with their coverage in alpha, so tinting and blending work like any other sprite. Glyphs are
+* never moved or evicted one by one. Quads already queued for drawing point at the texels they were built from, so the
+* atlas is never emptied in the middle of a frame: a glyph that does not fit is left out and the atlas marked full, and
+* EndFrame() then empties it and changes GetGeneration(), so geometry built from the old placements is rebuilt on the
+* next frame.
+*/
+class GlyphAtlas
+{
+public:
+	GlyphAtlas();
+	~GlyphAtlas();
+
+	void Init(const Vector2<u32>& size);
+	void Delete();
+
+	/**
+	* \brief Placement of \p glyph of \p font at \p pixelHeight, rasterizing and uploading it the first time. \p font must
+	* outlive the atlas or be dropped with Clear().
+	*
+	* While the atlas is full, glyphs not yet in it come back with a size of zero. Throws std::length_error if the glyph
+	* is larger than the whole atlas.
+	*/
+	const AtlasGlyph& GetGlyph(const Font& font, u32 glyph, u32 pixelHeight);
+
+	/**
+	* \brief Empties the atlas if a glyph did not fit since the last call. Call it once per frame, after the batches
+	* drawing glyphs from it have been ended.
+	*/
+	void EndFrame();
+
+	/**
+	* \brief Forgets every glyph and starts a new generation. Like EndFrame(), it must not be called while quads built
+	* from the atlas are waiting to be drawn.
+	*/
+	void Clear();
+
+	[[nodiscard]] const Texture2D& GetTexture() const;
+	[[nodiscard]] u32              GetGeneration() const;
+	[[nodiscard]] u32              GetGlyphCount() const;
+	[[nodiscard]] bool             IsFull() const;
+
+private:
+	struct Key
+	{
+	public:
+		const Font* font;
+		u32         glyph;
+		u32         pixelHeight;
+
+		bool operator==(const Key& other) const = default;
+	};
+
+	struct KeyHash
+	{
+	public:
+		size_t operator()(const Key& key) const;
+	};
+
+	Texture2D    _texture;
+	Vector2<u32> _size = Vector2<u32>(0u);
+
+	std::unordered_map<Key, AtlasGlyph, KeyHash> _glyphs;
+
+	// Shelf packing: glyphs fill the current shelf left to right, and a new shelf starts below the tallest of them
+	u32 _shelfX      = 0;
+	u32 _shelfY      = 0;
+	u32 _shelfHeight = 0;
+
+	u32  _generation = 0;
+	bool _full       = false;
+
+	// Returned for glyphs left out while the atlas is full
+	AtlasGlyph _missing;
+
+	// Reused between uploads to avoid allocating
+	std::vector<u8> _pixels;
+
+	bool Pack(const Vector2<u32>& size, Vector2<u32>& position);
+};
+
+}
+
+#endif
@@ -0,0 +1,114 @@
+#ifndef OTER_GPUPROFILER_HPP
+#define OTER_GPUPROFILER_HPP
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <OtterML/Common.hpp>
+
+namespace oter
+{
+
+struct GpuTiming
+{
+public:
+	std::string Name;
+	f64         AverageMilliseconds = 0.0;
+	f64         LastMilliseconds    = 0.0;
+	u32         SampleCount         = 0;
+};
+
+/**
+* \brief Measures GPU time spent in named regions with GL_TIMESTAMP queries.
+*
+* Each region writes a timestamp at its start and end, so regions may nest. Queries of a frame are only read back
+* FRAME_LATENCY frames later, when BeginFrame() is about to reuse them, by which point the GPU has normally finished
+* them. A query that is still not available is dropped instead of waited on, so profiling never stalls the pipeline.
+* Averages cover the last \p historySize frames in which each region was recorded.
+*/
+class GpuProfiler
+{
+public:
+	static constexpr u32 FRAME_LATENCY = 4;
+
+	/**
+	* \brief Ends the region when it goes out of scope.
+	*/
+	class Scope
+	{
+	public:
+		Scope(GpuProfiler& profiler, const std::string& name);
+		~Scope();
+
+		Scope(const Scope&)            = delete;
+		Scope& operator=(const Scope&) = delete;
+
+	private:
+		GpuProfiler& _profiler;
+	};
+
+	explicit GpuProfiler(u32 historySize = 60);
+	~GpuProfiler();
+
+	void Delete();
+
+	void BeginFrame();
+	void EndFrame();
+
+	void BeginRegion(const std::string& name);
+	void EndRegion();
+
+	/**
+	* \brief Rolling average of \p name in milliseconds, or 0 if it has no readings yet.
+	*/
+	[[nodiscard]] f64                    GetAverageMilliseconds(const std::string& name) const;
+	[[nodiscard]] std::vector<GpuTiming> GetTimings() const;
+
+private:
+	struct Query
+	{
+	public:
+		u32 region;
+		u32 begin;
+		u32 end;
+	};
+
+	struct Frame
+	{
+	public:
+		std::vector<Query> queries;
+		std::vector<u32>   freeNames;
+	};
+
+	struct Region
+	{
+	public:
+		std::string      name;
+		std::vector<f64> history;
+		u32              next = 0;
+		f64              sum  = 0.0;
+		f64              last = 0.0;
+	};
+
+	u32 _historySize;
+	u32 _frameIndex = 0;
+
+	Frame            _frames[FRAME_LATENCY];
+	std::vector<u32> _openQueries;
+
+	std::vector<Region>                  _regions;
+	std::unordered_map<std::string, u32> _regionIndices;
+
+	// Per-region totals while reading back one frame
+	std::vector<f64> _frameTotals;
+	std::vector<u8>  _frameTouched;
+
+	u32  TakeQueryName(Frame& frame);
+	void ReadBack(Frame& frame);
+	void AddSample(u32 region, f64 milliseconds);
+};
+
+}
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef OTER_HEADLESSCONTEXT_HPP
+#define OTER_HEADLESSCONTEXT_HPP
+
+#include <vector>
+
+#include <OtterML/Common.hpp>
+#include <OtterML/Vector2.hpp>
+
+namespace oter
+{
+
+class FrameBuffer;
+
+struct HeadlessContextSettings
+{
+public:
+	u32  MajorVersion = 4;
+	u32  MinorVersion = 1;
+	bool CoreProfile  = true;
+	bool Debug        = false;
+};
+
+/**
+* \brief GL context without a window or display server, created through EGL.
+*
+* Where Mesa's surfaceless platform is available (llvmpipe on a GPU-less server included), no surface exists at all
+* and drawing must go to a FrameBuffer. Otherwise the context falls back to the default EGL display with a pbuffer
+* of \p size, which also serves as the default framebuffer.
+*
+* Create() leaves the context current on the calling thread and loads GL through it, so OtterML can be used right away.
+* Only available when the library is configured with OTTERML_ENABLE_HEADLESS.
+*/
+class HeadlessContext
+{
+public:
+	HeadlessContext();
+	~HeadlessContext();
+
+	HeadlessContext(const HeadlessContext&)            = delete;
+	HeadlessContext& operator=(const HeadlessContext&) = delete;
+
+	/**
+	* \brief Throws std::runtime_error if no EGL display or context with \p settings can be created.
+	*/
+	void Create(const Vector2<u32>& size, const HeadlessContextSettings& settings = HeadlessContextSettings());
+	void Delete();
+
+	/**
+	* \brief Makes the context current on the calling thread and forgets the GLState shadow of the previous one.
+	*/
+	void MakeCurrent() const;
+
+	/**
+	* \brief Reads the color attachment of \p frameBuffer as tightly packed RGBA8 rows, bottom row first.
+	*/
+	[[nodiscard]] std::vector<u8> ReadPixels(FrameBuffer& frameBuffer) const;
+
+	[[nodiscard]] bool                IsCreated() const;
+	[[nodiscard]] bool                IsSurfaceless() const;
+	[[nodiscard]] const Vector2<u32>& GetSize() const;
+
+private:
+	// EGLDisplay, EGLContext and EGLSurface, kept opaque so EGL stays out of this header
+	void*        _display = nullptr;
+	void*        _context = nullptr;
+	void*        _surface = nullptr;
+	Vector2<u32> _size;
+};
+
+}
+
+#endif
@@ -0,0 +1,95 @@
+#ifndef OTER_INSTANCEDSPRITEBATCH_HPP
+#define OTER_INSTANCEDSPRITEBATCH_HPP
+
+#include <span>
+#include <vector>
+
+#include <OtterML/Color.hpp>
+#include <OtterML/Matrix.hpp>
+#include <OtterML/StreamBuffer.hpp>
+#include <OtterML/Vector2.hpp>
+
+namespace oter
+{
+class Shader;
+class Texture2D;
+
+/**
+* \brief Per-instance data read by InstancedSpriteBatch: the top two rows of the sprite's affine transform, with its size
+* already folded in, the texture rectangle and a packed RGBA8 color.
+*
+* Bound as attribute 0 (vec3 first row), 1 (vec3 second row), 2 (vec4 UV position and size) and 3 (normalized vec4 color),
+* all with a divisor of 1.
+*/
+struct SpriteInstance
+{
+public:
+	f32   Row0[3] = { 1.f, 0.f, 0.f };
+	f32   Row1[3] = { 0.f, 1.f, 0.f };
+	f32   UVX     = 0.f;
+	f32   UVY     = 0.f;
+	f32   UVW     = 1.f;
+	f32   UVH     = 1.f;
+	Color Tint    = Color(0xFF, 0xFF, 0xFF);
+};
+
+static_assert(sizeof(SpriteInstance) == 44, "oter::SpriteInstance must stay tightly packed for GPU uploads.");
+
+/**
+* \brief Draws any number of quads that share one shader and one texture with a single instanced draw call.
+*
+* Unlike SpriteBatch, no vertices are expanded on the CPU: each sprite is one SpriteInstance, and the vertex shader builds
+* the quad corners from gl_VertexID. Instances are collected between Begin() and End() and streamed into a StreamBuffer.
+* VERTEX_SOURCE and FRAGMENT_SOURCE are a minimal shader pair that reads the instance attributes.
+*/
+class InstancedSpriteBatch
+{
+public:
+	static const char* const VERTEX_SOURCE;
+	static const char* const FRAGMENT_SOURCE;
+
+	InstancedSpriteBatch();
+	~InstancedSpriteBatch();
+
+	void Init();
+	void Delete();
+
+	void Begin();
+
+	void Draw(const SpriteInstance& instance);
+
+	/**
+	* \brief Queues a quad of \p size, placed by \p transform, showing the texture region starting at \p uvPosition.
+	*/
+	void Draw(const Matrix<f32, 3, 3>& transform, const Vector2<f32>& size, const Vector2<f32>& uvPosition,
+	          const Vector2<f32>& uvSize, const Color& color = Color(0xFF, 0xFF, 0xFF));
+
+	/**
+	* \brief Queues one quad per transform, all with the same size, texture region and color, such as the render matrices
+	* of a TransformStore.
+	*/
+	void Draw(std::span<const Matrix<f32, 3, 3>> transforms, const Vector2<f32>& size, const Vector2<f32>& uvPosition,
+	          const Vector2<f32>& uvSize, const Color& color = Color(0xFF, 0xFF, 0xFF));
+
+	/**
+	* \brief Uploads every queued instance and draws them all with \p texture bound to unit 0.
+	*/
+	void End(const Texture2D& texture, const Shader& shader);
+
+	[[nodiscard]] u32 GetInstanceCount() const;
+
+private:
+	u32          _vao = 0;
+	StreamBuffer _instanceStream;
+
+	std::vector<SpriteInstance> _instances;
+
+	u32 _instanceCount = 0;
+
+	static SpriteInstance MakeInstance(const Matrix<f32, 3, 3>& transform, const Vector2<f32>& size,
+	                                   const Vector2<f32>& uvPosition, const Vector2<f32>& uvSize, const Color& color);
+};
+
+}
+
+#endif
@@ -83,9 +83,10 @@ public:
 	{
 		throw;
 	}
-	friend Matrix operator*(const Matrix& left, const Matrix& right)
+	friend Matrix operator*(Matrix left, const Matrix& right)
 	{
-		throw;
+		left *= right;
+		return left;
 	}
 	friend Matrix operator/(const Matrix& left, const Matrix& right)
 	{
@@ -278,6 +279,28 @@ Matrix<T, Tx, Ty> Matrix<T, Tx, Ty>::GetInverse() const
 	return inverse;
 }
 
+template <typename T, unsigned Tx, unsigned Ty>
+Matrix<T, Tx, Ty>& Matrix<T, Tx, Ty>::operator*=(const Matrix& right)
+{
+	static_assert(Tx == Ty, "Matrix multiplication is only supported for square matrices.");
+
+	std::array<T, Tx * Ty> result;
+	for (u32 row = 0; row < Ty; row++)
+	{
+		for (u32 column = 0; column < Tx; column++)
+		{
+			T sum = static_cast<T>(0);
+			for (u32 i = 0; i < Tx; i++)
+			{
+				sum += this->_data[row * Tx + i] * right._data[i * Tx + column];
+			}
+			result[row * Tx + column] = sum;
+		}
+	}
+	this->_data = result;
+	return *this;
+}
+
 template <typename T, unsigned Tx, unsigned Ty>
 const Matrix<T, Tx, Ty> Matrix<T, Tx, Ty>::Zero(static_cast<T>(0));
 template <typename T, unsigned Tx, unsigned Ty>
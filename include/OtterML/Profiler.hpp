@@ -0,0 +1,101 @@
+#ifndef OTER_PROFILER_HPP
+#define OTER_PROFILER_HPP
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <OtterML/Common.hpp>
+
+namespace oter
+{
+
+/**
+* \brief One finished zone. \p Name must outlive the profiler, which string literals do.
+*/
+struct ProfileEvent
+{
+public:
+	const char* Name        = nullptr;
+	u64         Start       = 0;
+	u64         End         = 0;
+	u32         ThreadIndex = 0;
+};
+
+/**
+* \brief Collects timed zones from every thread and exports them as a Chrome trace.
+*
+* Each thread records into its own fixed-size ring buffer with one writer (the thread) and one reader (Collect()), so
+* recording takes no locks. A full ring drops new zones and counts them rather than blocking. Timestamps come from
+* steady_clock, in nanoseconds since the profiler started.
+*
+* Use the OTTERML_PROFILE_ZONE and OTTERML_PROFILE_FUNCTION macros rather than ProfileZone directly: unless the library
+* is configured with OTTERML_ENABLE_PROFILING, they expand to nothing.
+*/
+class Profiler
+{
+public:
+	static constexpr u32 RING_CAPACITY = 1 << 16;
+
+	Profiler() = delete;
+
+	static void Record(const char* name, u64 start, u64 end);
+
+	[[nodiscard]] static u64 Now();
+
+	/**
+	* \brief Moves every zone recorded since the last call out of the ring buffers and keeps them for export.
+	*/
+	static void Collect();
+
+	/**
+	* \brief Writes every collected zone as Chrome trace event JSON, readable by chrome://tracing and Perfetto.
+	*/
+	static void WriteChromeTrace(std::ostream& stream);
+	static bool SaveChromeTrace(const std::string& path);
+
+	/**
+	* \brief Drops every collected zone.
+	*/
+	static void Clear();
+
+	[[nodiscard]] static const std::vector<ProfileEvent>& GetEvents();
+	[[nodiscard]] static u64                              GetDroppedCount();
+};
+
+/**
+* \brief Records the time between its construction and destruction as a zone.
+*/
+class ProfileZone
+{
+public:
+	explicit ProfileZone(const char* name)
+		: _name(name), _start(Profiler::Now()) {}
+
+	~ProfileZone()
+	{
+		Profiler::Record(this->_name, this->_start, Profiler::Now());
+	}
+
+	ProfileZone(const ProfileZone&)            = delete;
+	ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+	const char* _name;
+	u64         _start;
+};
+
+}
+
+#define OTTERML_PROFILE_CONCAT_INNER(a, b) a##b
+#define OTTERML_PROFILE_CONCAT(a, b)       OTTERML_PROFILE_CONCAT_INNER(a, b)
+
+#ifdef OTTERML_ENABLE_PROFILING
+	#define OTTERML_PROFILE_ZONE(name) ::oter::ProfileZone OTTERML_PROFILE_CONCAT(otterProfileZone, __LINE__)(name)
+	#define OTTERML_PROFILE_FUNCTION() OTTERML_PROFILE_ZONE(__func__)
+#else
+	#define OTTERML_PROFILE_ZONE(name)
+	#define OTTERML_PROFILE_FUNCTION()
+#endif
+
+#endif
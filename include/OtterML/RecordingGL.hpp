@@ -0,0 +1,77 @@
+#ifndef OTER_RECORDINGGL_HPP
+#define OTER_RECORDINGGL_HPP
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <glad/gl.h>
+
+#include <OtterML/Common.hpp>
+
+namespace oter
+{
+
+struct GLCall
+{
+public:
+	const char* Name = nullptr;
+	std::string Arguments;
+};
+
+/**
+* \brief GL backend that records calls instead of executing them, for driver-free tests of call counts and uploads.
+*
+* Install() loads every GL entry point, the optional ones in GLExtensions included, with stubs that count each call
+* and, while logging is on, keep its arguments in order. Nothing is drawn. Just enough state is simulated for OtterML
+* to run: glGen* and glCreate* hand out fresh names, shaders compile and link, framebuffers are complete, queries and
+* fences are done at once, and buffer storage is real memory, so mapped writes and uploads can be inspected.
+*
+* The context reports the version passed to Install() and no extensions, so GLExtensions entry points are present
+* exactly when that version has them. The recorder replaces the GL entry points for the whole process; loading GL from
+* a real context again puts the driver back.
+*/
+class RecordingGL
+{
+public:
+	RecordingGL() = delete;
+
+	/**
+	* \brief Points GL at the recorder, clears everything recorded, and invalidates GLState.
+	*/
+	static bool Install(u32 majorVersion = 4, u32 minorVersion = 1);
+
+	/**
+	* \brief Loader for gladLoadGL and LoadGL, returning the stub for \p name.
+	*/
+	static GLADapiproc GetProcAddress(const char* name);
+
+	/**
+	* \brief With logging off, calls are still counted but their arguments are not kept.
+	*/
+	static void SetLogging(bool logging);
+
+	/**
+	* \brief Forgets the recorded calls, counts and uploaded bytes. Names and buffer storage are kept.
+	*/
+	static void Clear();
+
+	[[nodiscard]] static const std::vector<GLCall>& GetCalls();
+	[[nodiscard]] static u64                        GetCallCount();
+	[[nodiscard]] static u64                        GetCallCount(std::string_view name);
+
+	/**
+	* \brief Bytes passed to buffer and texture uploads, plus the length of every mapped buffer range.
+	*/
+	[[nodiscard]] static u64 GetUploadedBytes();
+
+	/**
+	* \brief Storage of buffer \p buffer, as left by uploads and writes through mapped pointers.
+	*/
+	[[nodiscard]] static std::span<const u8> GetBufferContents(u32 buffer);
+};
+
+}
+
+#endif
@@ -0,0 +1,122 @@
+#ifndef OTER_RENDERGRAPH_HPP
+#define OTER_RENDERGRAPH_HPP
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <OtterML/FrameBuffer.hpp>
+
+namespace oter
+{
+
+/**
+* \brief Orders, culls and allocates render passes from what each one reads and writes.
+*
+* Each pass reads any number of resources and writes exactly one. A resource has exactly one writer, so the graph is
+* the same whatever order the passes were added in, and Execute() runs every pass after the writers of what it reads.
+* Passes that do not lead, directly or through other passes, to an imported resource are culled.
+*
+* Transient resources get a FrameBuffer from the pool just before the pass that writes them and give it back after the
+* last pass that reads them, so transients whose lifetimes do not overlap end up sharing the same FrameBuffer.
+*
+* The graph is meant to be rebuilt every frame: add passes, Execute(), then Reset().
+*/
+class RenderGraph
+{
+public:
+	using Resource     = u32;
+	using PassFunction = std::function<void(const RenderGraph& graph)>;
+
+	explicit RenderGraph(FrameBufferPool& pool);
+
+	/**
+	* \brief Declares a render target that only lives for this frame.
+	*/
+	Resource CreateTransient(const std::string& name, const FrameBufferFormat& format);
+
+	/**
+	* \brief Declares a FrameBuffer owned outside the graph. Imported resources are the graph's outputs.
+	*/
+	Resource Import(const std::string& name, FrameBuffer& frameBuffer);
+
+	/**
+	* \brief Declares the window's framebuffer as an output of size \p size.
+	*/
+	Resource ImportBackBuffer(const Vector2<u32>& size);
+
+	/**
+	* \brief Adds a pass that samples \p reads and draws into \p target. \p target is bound and every read is resolved
+	* before \p execute runs.
+	*/
+	void AddPass(const std::string& name, const std::vector<Resource>& reads, Resource target, const PassFunction& execute);
+
+	/**
+	* \brief Orders and culls the passes, then runs them. Throws std::logic_error if the passes form a cycle.
+	*/
+	void Execute();
+
+	/**
+	* \brief Removes every pass and resource, ready for the next frame.
+	*/
+	void Reset();
+
+	/**
+	* \brief Color texture of \p resource, for use inside a pass that declared it as a read.
+	*/
+	[[nodiscard]] const Texture2D&   GetTexture(Resource resource) const;
+	[[nodiscard]] const FrameBuffer& GetFrameBuffer(Resource resource) const;
+
+	/**
+	* \brief Names of the passes the last Execute() ran, in the order it ran them.
+	*/
+	[[nodiscard]] std::vector<std::string> GetExecutionOrder() const;
+	[[nodiscard]] u32                      GetCulledPassCount() const;
+
+	/**
+	* \brief Distinct pooled FrameBuffers the last Execute() used for all its transient resources.
+	*/
+	[[nodiscard]] u32 GetTransientFrameBufferCount() const;
+
+private:
+	static constexpr u32 NONE = UINT32_MAX;
+
+	struct ResourceNode
+	{
+	public:
+		std::string       name;
+		FrameBufferFormat format;
+		FrameBuffer*      frameBuffer = nullptr;
+		bool              imported    = false;
+		bool              backBuffer  = false;
+		u32               writer      = NONE;
+		u32               lastUse     = NONE;
+	};
+
+	struct PassNode
+	{
+	public:
+		std::string           name;
+		std::vector<Resource> reads;
+		Resource              target;
+		PassFunction          execute;
+	};
+
+	FrameBufferPool& _pool;
+
+	std::vector<ResourceNode> _resources;
+	std::vector<PassNode>     _passes;
+	std::vector<u32>          _order;
+
+	u32 _culledPassCount           = 0;
+	u32 _transientFrameBufferCount = 0;
+
+	Resource AddResource(ResourceNode&& resource);
+	void     Compile();
+
+	[[nodiscard]] const ResourceNode& GetResource(Resource resource) const;
+};
+
+}
+
+#endif
@@ -0,0 +1,130 @@
+#ifndef OTER_RENDERQUEUE_HPP
+#define OTER_RENDERQUEUE_HPP
+
+#include <vector>
+
+#include <OtterML/AlignedAllocator.hpp>
+#include <OtterML/Common.hpp>
+
+namespace oter
+{
+class Shader;
+class Texture2D;
+
+/**
+* \brief One draw recorded for later execution on the GL thread.
+*
+* Draws \p Count vertices (or indices, if \p Indexed) starting at \p First from \p VertexArray, with \p Program in use and
+* \p Texture bound to unit 0. Indices are read as GL_UNSIGNED_INT from the vertex array's element buffer.
+*/
+struct RenderCommand
+{
+public:
+	u64              Key           = 0;
+	const Shader*    Program       = nullptr;
+	const Texture2D* Texture       = nullptr;
+	u32              VertexArray   = 0;
+	u32              Mode          = 0x0004; // GL_TRIANGLES
+	u32              First         = 0;
+	u32              Count         = 0;
+	u32              InstanceCount = 1;
+	bool             Indexed       = false;
+};
+
+/**
+* \brief Commands recorded by a single thread. Lists are cache line aligned so neighbouring lists never share a line.
+*/
+class alignas(CACHE_LINE_SIZE) RenderCommandList
+{
+public:
+	/**
+	* \brief Throws std::invalid_argument if the command has no program.
+	*/
+	void Add(const RenderCommand& command);
+	void Clear();
+
+	[[nodiscard]] u32 GetCount() const;
+
+private:
+	friend class RenderQueue;
+
+	std::vector<RenderCommand> _commands;
+};
+
+/**
+* \brief Collects draws from any number of threads and executes them on the GL thread in sort key order.
+*
+* Each recording thread fills its own RenderCommandList, picked by index, so recording needs no locks. Execute() merges the
+* lists in index order, radix-sorts the merged commands by key and issues them, only changing the program, texture or
+* vertex array when it differs from the previous command. The sort is stable, so commands with equal keys run in the
+* order they were recorded, and the result is the same however the recording work was spread across threads.
+*
+* Keys built with MakeKey() sort by layer first, then shader, then texture, then depth, which groups draws that share
+* state while still letting layers be drawn in order.
+*/
+class RenderQueue
+{
+public:
+	static constexpr u32 LAYER_BITS   = 8;
+	static constexpr u32 SHADER_BITS  = 16;
+	static constexpr u32 TEXTURE_BITS = 16;
+	static constexpr u32 DEPTH_BITS   = 24;
+
+	explicit RenderQueue(u32 listCount = 1);
+
+	/**
+	* \brief Packs a sort key. Shader and texture IDs are truncated to their bit widths, which only affects grouping.
+	* \p depth is clamped to [0, 1]; pass 1 - depth to draw back to front.
+	*/
+	[[nodiscard]] static u64 MakeKey(u8 layer, u32 shaderID, u32 textureID, f32 depth);
+
+	void              SetListCount(u32 listCount);
+	[[nodiscard]] u32 GetListCount() const;
+
+	/**
+	* \brief List for one recording thread. Different threads may record into different lists at the same time.
+	*/
+	[[nodiscard]] RenderCommandList& GetList(u32 index);
+
+	/**
+	* \brief Sorts and issues every recorded command, then clears all lists. Must be called on the GL thread.
+	*/
+	void Execute();
+
+	/**
+	* \brief Clears all lists without drawing.
+	*/
+	void Clear();
+
+	/**
+	* \brief Draw calls issued by the last Execute().
+	*/
+	[[nodiscard]] u32 GetDrawCount() const;
+
+	/**
+	* \brief Program, texture and vertex array binds issued by the last Execute().
+	*/
+	[[nodiscard]] u32 GetStateChangeCount() const;
+
+private:
+	struct SortEntry
+	{
+	public:
+		u64 key;
+		u32 index;
+	};
+
+	std::vector<RenderCommandList> _lists;
+	std::vector<RenderCommand>      _merged;
+	std::vector<SortEntry>          _entries;
+	std::vector<SortEntry>          _scratch;
+
+	u32 _drawCount        = 0;
+	u32 _stateChangeCount = 0;
+
+	void Sort();
+};
+
+}
+
+#endif
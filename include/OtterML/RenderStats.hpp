@@ -0,0 +1,88 @@
+#ifndef OTER_RENDERSTATS_HPP
+#define OTER_RENDERSTATS_HPP
+
+#include <OtterML/Common.hpp>
+
+namespace oter
+{
+
+enum class RenderCounter : u8
+{
+	DrawCalls,
+	Triangles,
+	ProgramBinds,
+	TextureBinds,
+	BufferBinds,
+	BufferBytesUploaded,
+	TextureBytesUploaded,
+	UniformCalls,
+	Count,
+};
+
+constexpr u32 RENDER_COUNTER_COUNT = static_cast<u32>(RenderCounter::Count);
+
+/**
+* \brief One counter over the frames in the window. Last is the most recently finished frame.
+*/
+struct RenderStatRange
+{
+public:
+	u64 Last    = 0;
+	u64 Min     = 0;
+	u64 Max     = 0;
+	f64 Average = 0.0;
+};
+
+struct RenderStatsSnapshot
+{
+public:
+	RenderStatRange Counters[RENDER_COUNTER_COUNT];
+	u32             FrameCount = 0;
+
+	[[nodiscard]] const RenderStatRange& Get(RenderCounter counter) const;
+};
+
+/**
+* \brief Per-frame counts of draws, triangles, issued binds, uploads and uniform calls.
+*
+* Renderer, Shader, Texture2D and the batchers add to the counters of the current frame as they issue GL calls, and
+* binds are counted by GLState only when they reach GL. EndFrame() files the frame into a window of the last
+* WINDOW_SIZE frames and starts a new one. Counting is a thread-local add, so the stats can stay on in release builds.
+* Like GLState, the counters are per thread, matching the context current on it.
+*/
+class RenderStats
+{
+public:
+	static constexpr u32 WINDOW_SIZE = 120;
+
+	RenderStats() = delete;
+
+	static void Add(RenderCounter counter, u64 amount = 1);
+
+	/**
+	* \brief Counts one draw call and the triangles it produces for \p mode, a GL primitive type.
+	*/
+	static void AddDraw(u32 mode, u64 vertexCount, u64 instanceCount = 1);
+
+	/**
+	* \brief Triangles produced by \p vertexCount vertices of GL primitive type \p mode, 0 for points and lines.
+	*/
+	[[nodiscard]] static u64 GetTriangleCount(u32 mode, u64 vertexCount);
+
+	static void EndFrame();
+
+	/**
+	* \brief Running total of \p counter in the frame that has not ended yet.
+	*/
+	[[nodiscard]] static u64                 GetCurrent(RenderCounter counter);
+	[[nodiscard]] static RenderStatsSnapshot GetSnapshot();
+
+	/**
+	* \brief Clears the current frame and the window.
+	*/
+	static void Reset();
+};
+
+}
+
+#endif
@@ -3,8 +3,9 @@
 
 #include <OtterML/Common.hpp>
 
-#include <unordered_map>
-#include <vector>
+#include <glad/gl.h>
+#include <OtterML/GLResourceRegistry.hpp>
+#include <OtterML/GLState.hpp>
 
 namespace oter
 {
@@ -17,30 +18,55 @@ public:
 	Renderer() {}
 	~Renderer()
 	{
-		std::vector<u32> buffers = std::vector<u32>(this->_vbos.size());
-		for (auto iter = this->_vbos.begin(); iter != this->_vbos.end(); ++iter)
-		{
-			buffers.push_back(iter->second);
-		}
-		glDeleteBuffers(this->_vbos.size(), buffers.data());
-		glDeleteVertexArrays(1, &this->_vao);
+		this->_resources.Clear();
+		GLState::DeleteVertexArrays(1, &this->_vao);
 	}
 
 	void Init()
 	{
 		glGenVertexArrays(1, &this->_vao);
-		glBindVertexArray(this->_vao);
+		GLState::BindVertexArray(this->_vao);
 	}
 
-	void BindVAO();
-	void CreateVBO(T* drawable);
-	void BindVBO(T* drawable);
+	void BindVAO()
+	{
+		GLState::BindVertexArray(this->_vao);
+	}
+
+	/**
+	* \brief Creates a vertex buffer owned by this renderer. Keep the handle with the drawable that uses it.
+	*/
+	BufferHandle CreateVBO()
+	{
+		return this->_resources.CreateBuffer();
+	}
+
+	void BindVBO(const BufferHandle vbo)
+	{
+		GLState::BindBuffer(GL_ARRAY_BUFFER, this->_resources.Get(vbo));
+	}
+
+	/**
+	* \brief Invalidates \p vbo immediately; the buffer itself is deleted by the next FlushDeletions().
+	*/
+	void DestroyVBO(const BufferHandle vbo)
+	{
+		this->_resources.Destroy(vbo);
+	}
+
+	/**
+	* \brief Deletes the buffers destroyed since the last call. Call once per frame, after drawing.
+	*/
+	void FlushDeletions()
+	{
+		this->_resources.FlushDeletions();
+	}
 
 	void Draw(T& drawable, const Shader& shader);
 
 private:
-	u32                         _vao  = 0;
-	std::unordered_map<T*, u32> _vbos = {};
+	u32                _vao = 0;
+	GLResourceRegistry _resources;
 };
 
 }
@@ -0,0 +1,86 @@
+#ifndef OTER_SHAPEBATCH_HPP
+#define OTER_SHAPEBATCH_HPP
+
+#include <span>
+#include <vector>
+
+#include <OtterML/StreamBuffer.hpp>
+#include <OtterML/Vector2.hpp>
+#include <OtterML/Vertex2D.hpp>
+
+namespace oter
+{
+class Shader;
+
+/**
+* \brief Immediate-mode batch of untextured lines and filled shapes, for debug overlays and other throwaway geometry.
+*
+* Shapes are collected between Begin() and End(). Outlines become line segments and filled shapes become triangles.
+* Each kind is written to its own StreamBuffer, so End() draws any number of shapes with one glDrawArrays for lines
+* and one for triangles. Lines are drawn after triangles, so outlines stay on top of fills.
+*
+* The shader is expected to read the Vertex2D attributes; SpriteBatch::VERTEX_SOURCE with FRAGMENT_SOURCE is a
+* minimal pair that does. Texture coordinates are always zero.
+*/
+class ShapeBatch
+{
+public:
+	static const char* const FRAGMENT_SOURCE;
+
+	ShapeBatch();
+	~ShapeBatch();
+
+	void Init();
+	void Delete();
+
+	void Begin();
+
+	void Line(const Vector2<f32>& from, const Vector2<f32>& to, const Color& color);
+	void Rect(const Vector2<f32>& position, const Vector2<f32>& size, const Color& color, bool filled = false);
+
+	/**
+	* \brief With \p segments of 0, the count is picked from \p radius so the edge stays within a quarter pixel of a
+	* true circle.
+	*/
+	void Circle(const Vector2<f32>& center, f32 radius, const Color& color, bool filled = false, u32 segments = 0);
+
+	/**
+	* \brief Closed polygon through \p points. Filled polygons are drawn as a fan from the first point, so they must be
+	* convex.
+	*/
+	void Polygon(std::span<const Vector2<f32>> points, const Color& color, bool filled = false);
+
+	void End(const Shader& shader);
+
+	/**
+	* \brief Number of draw calls the last End() issued, at most one per primitive type.
+	*/
+	[[nodiscard]] u32 GetDrawCallCount() const;
+	[[nodiscard]] u32 GetLineCount() const;
+	[[nodiscard]] u32 GetTriangleCount() const;
+
+private:
+	struct Layer
+	{
+	public:
+		u32                   vao = 0;
+		StreamBuffer          stream;
+		std::vector<Vertex2D> vertices;
+	};
+
+	Layer _triangles;
+	Layer _lines;
+
+	u32 _drawCallCount = 0;
+	u32 _lineCount     = 0;
+	u32 _triangleCount = 0;
+
+	void AddVertex(Layer& layer, const Vector2<f32>& position, const Color& color);
+
+	// Returns whether a draw was issued
+	bool Flush(Layer& layer, u32 mode);
+};
+
+}
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef OTER_SPRITEBATCH_HPP
+#define OTER_SPRITEBATCH_HPP
+
+#include <span>
+#include <vector>
+
+#include <OtterML/Matrix.hpp>
+#include <OtterML/StreamBuffer.hpp>
+#include <OtterML/Vector2.hpp>
+#include <OtterML/Vertex2D.hpp>
+
+namespace oter
+{
+class Shader;
+class Texture2D;
+
+enum class SpriteSortMode : u8
+{
+	/**
+	* \brief Groups sprites by shader and texture, which gives the fewest draws but does not keep submission order
+	* between sprites that use different textures.
+	*/
+	ShaderTexture,
+
+	/**
+	* \brief Keeps submission order and only merges neighbouring sprites that share a shader and texture.
+	*/
+	Submission,
+};
+
+/**
+* \brief Streams quads for many sprites into one shared vertex buffer and draws them with one call per shader/texture batch.
+*
+* Sprites are collected between Begin() and End(). End() sorts them, writes every vertex into a StreamBuffer and issues one
+* glDrawElements per run of sprites that share a shader and texture. The shader is expected to read the Vertex2D
+* attributes and sample its texture from unit 0; VERTEX_SOURCE and FRAGMENT_SOURCE are a minimal pair that does.
+*/
+class SpriteBatch
+{
+public:
+	static const char* const VERTEX_SOURCE;
+	static const char* const FRAGMENT_SOURCE;
+
+	SpriteBatch();
+	~SpriteBatch();
+
+	void Init();
+	void Delete();
+
+	void Begin(SpriteSortMode sortMode = SpriteSortMode::ShaderTexture);
+
+	/**
+	* \brief Queues a quad of \p size, placed by \p transform, showing the texture region starting at \p uvPosition.
+	*/
+	void Draw(const Texture2D& texture, const Shader& shader, const Matrix<f32, 3, 3>& transform,
+	          const Vector2<f32>& size, const Vector2<f32>& uvPosition, const Vector2<f32>& uvSize,
+	          const Color& color = Color(0xFF, 0xFF, 0xFF));
+
+	/**
+	* \brief Queues one frame of a sprite sheet, sized by the texture's frame size, with \p framePosition in pixels.
+	*/
+	void Draw(const Texture2D& texture, const Shader& shader, const Matrix<f32, 3, 3>& transform,
+	          const Vector2<u32>& framePosition, const Color& color = Color(0xFF, 0xFF, 0xFF));
+
+	/**
+	* \brief Queues ready-made quads as one sprite, four vertices each in the order top-left, top-right, bottom-left,
+	* bottom-right. The vertices are copied as they are, so cached geometry costs one copy per frame.
+	*/
+	void Draw(const Texture2D& texture, const Shader& shader, std::span<const Vertex2D> quads);
+
+	void End();
+
+	/**
+	* \brief Number of draw calls the last End() issued.
+	*/
+	[[nodiscard]] u32 GetBatchCount() const;
+	[[nodiscard]] u32 GetSpriteCount() const;
+
+private:
+	struct Sprite
+	{
+	public:
+		const Texture2D* texture;
+		const Shader*    shader;
+		u64              key;
+		u32              firstVertex;
+		u32              quadCount;
+	};
+
+	u32          _vao = 0;
+	u32          _ibo = 0;
+	StreamBuffer _vertexStream;
+
+	u32 _iboCapacity = 0;
+
+	SpriteSortMode _sortMode = SpriteSortMode::ShaderTexture;
+
+	std::vector<Sprite>   _sprites;
+	std::vector<Vertex2D> _vertices;
+	std::vector<Vertex2D> _sortedVertices;
+
+	u32 _batchCount  = 0;
+	u32 _spriteCount = 0;
+
+	// Returns the base vertex the uploaded quads start at
+	u32 Upload(const std::vector<Vertex2D>& vertices, u32 quadCount);
+};
+
+}
+
+#endif
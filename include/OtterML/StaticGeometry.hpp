@@ -0,0 +1,91 @@
+#ifndef OTER_STATICGEOMETRY_HPP
+#define OTER_STATICGEOMETRY_HPP
+
+#include <span>
+#include <vector>
+
+#include <OtterML/Vertex2D.hpp>
+
+namespace oter
+{
+class Shader;
+class Texture2D;
+
+/**
+* \brief Packs meshes that never move into shared vertex, index and indirect buffers and draws all of them with one
+* glMultiDrawElementsIndirect call.
+*
+* Every mesh added becomes one indirect draw command pointing at its range of the shared buffers, so the CPU cost of
+* Draw() does not depend on how many meshes there are. Adding meshes re-uploads the buffers on the next Draw(); hiding
+* or showing a mesh only rewrites its command's instance count.
+*
+* All meshes are drawn with the same shader and texture, so use one StaticGeometry per texture atlas. Vertices are in
+* the Vertex2D layout and indices are relative to the start of their own mesh. Without GL 4.3 or
+* ARB_multi_draw_indirect, Draw() falls back to one glDrawElementsIndirect per mesh.
+*/
+class StaticGeometry
+{
+public:
+	using Mesh = u32;
+
+	StaticGeometry();
+	~StaticGeometry();
+
+	void Init();
+	void Delete();
+
+	/**
+	* \brief Adds a triangle-list mesh and returns the handle used to show or hide it.
+	*/
+	Mesh Add(std::span<const Vertex2D> vertices, std::span<const u32> indices);
+
+	/**
+	* \brief Removes every mesh. Previously returned handles become invalid.
+	*/
+	void Clear();
+
+	void              SetVisible(Mesh mesh, bool visible);
+	[[nodiscard]] bool IsVisible(Mesh mesh) const;
+
+	[[nodiscard]] u32 GetMeshCount() const;
+
+	void Draw(const Texture2D& texture, const Shader& shader);
+
+	/**
+	* \brief Draw calls issued by the last Draw(): 1 with multi-draw-indirect, otherwise one per mesh.
+	*/
+	[[nodiscard]] u32 GetDrawCallCount() const;
+
+private:
+	// Layout fixed by GL for glDrawElementsIndirect
+	struct DrawCommand
+	{
+	public:
+		u32 count;
+		u32 instanceCount;
+		u32 firstIndex;
+		i32 baseVertex;
+		u32 baseInstance;
+	};
+
+	u32 _vao      = 0;
+	u32 _vbo      = 0;
+	u32 _ibo      = 0;
+	u32 _indirect = 0;
+
+	std::vector<Vertex2D>    _vertices;
+	std::vector<u32>         _indices;
+	std::vector<DrawCommand> _commands;
+
+	bool _uploaded      = false;
+	u32  _drawCallCount = 0;
+
+	// Triangles of the visible meshes, kept up to date so Draw() never walks the commands
+	u64 _triangleCount = 0;
+
+	void Upload();
+};
+
+}
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef OTER_STREAMBUFFER_HPP
+#define OTER_STREAMBUFFER_HPP
+
+#include <vector>
+
+#include <OtterML/Common.hpp>
+
+namespace oter
+{
+
+/**
+* \brief Ring buffer for data that is rewritten every frame, such as dynamic vertices.
+*
+* Where glBufferStorage is available, the buffer is mapped once as persistent and coherent and split into regions.
+* Writes are plain memcpys into the current region. When a region is left, a fence is placed behind it, and the fence
+* is waited on before the region is written again, so the CPU never overwrites data the GPU has yet to read.
+*
+* Otherwise the buffer falls back to orphaning: the storage is re-specified with glBufferData whenever it wraps around,
+* and data is written with unsynchronized glMapBufferRange.
+*/
+class StreamBuffer
+{
+public:
+	static constexpr u32 DEFAULT_REGION_COUNT = 3;
+
+	StreamBuffer();
+	~StreamBuffer();
+
+	/**
+	* \brief Creates the buffer. \p target is the GL binding point used for uploads in the fallback path, such as GL_ARRAY_BUFFER.
+	*/
+	void Init(u32 target, u32 regionSize, u32 regionCount = DEFAULT_REGION_COUNT, bool allowPersistent = true);
+	void Delete();
+
+	/**
+	* \brief Reserves \p size bytes at an offset that is a multiple of \p alignment and returns a pointer to write them to.
+	*
+	* The offset from the start of the buffer is written to \p offset. The pointer stays valid until Unmap().
+	* If \p size does not fit in a region, the buffer grows, which replaces the GL buffer, so anything written
+	* earlier must already have been drawn.
+	*/
+	void* Map(u32 size, u32 alignment, u32& offset);
+	void  Unmap();
+
+	/**
+	* \brief Copies \p size bytes into the buffer and returns the offset they were written at.
+	*/
+	u32 Write(const void* data, u32 size, u32 alignment = 4);
+
+	/**
+	* \brief Fences the current region and moves on to the next one. Calling it once per frame keeps frames in separate regions.
+	*/
+	void EndFrame();
+
+	[[nodiscard]] u32  GetID() const;
+	[[nodiscard]] bool IsPersistent() const;
+
+private:
+	u32  _id          = 0;
+	u32  _target      = 0;
+	u32  _regionSize  = 0;
+	u32  _regionCount = 0;
+	u32  _region      = 0;
+	u32  _offset      = 0;
+	bool _persistent  = false;
+	bool _mapped      = false;
+	u8*  _memory      = nullptr;
+
+	std::vector<void*> _fences;
+
+	void Create();
+	void Destroy();
+	void NextRegion();
+	void WaitForRegion(u32 region);
+};
+
+}
+
+#endif
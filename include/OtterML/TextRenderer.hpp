@@ -0,0 +1,97 @@
+#ifndef OTER_TEXTRENDERER_HPP
+#define OTER_TEXTRENDERER_HPP
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <OtterML/Color.hpp>
+#include <OtterML/Vector2.hpp>
+#include <OtterML/Vertex2D.hpp>
+
+namespace oter
+{
+class Font;
+class GlyphAtlas;
+class Shader;
+class SpriteBatch;
+
+/**
+* \brief Lays out UTF-8 strings into glyph quads from a GlyphAtlas and queues them on a SpriteBatch, caching every run
+* by its content.
+*
+* A run is keyed by a hash of its text, font and pixel height. Laying it out once maps characters to glyphs, applies
+* kerning, breaks lines at '\n' and builds its quads. Drawn again at the same position and color, the run's placed
+* vertices are handed to the batch as they are, so static text costs one copy per frame; a new position or color only
+* re-places the cached quads. Runs are laid out again when the atlas starts a new generation.
+*
+* Positions are in pixels with y growing downward: \p position is the top-left corner of the first line. Runs that were
+* not drawn or measured between two EndFrame() calls are dropped.
+*/
+class TextRenderer
+{
+public:
+	TextRenderer();
+	~TextRenderer();
+
+	/**
+	* \brief \p atlas must outlive the renderer, and every font drawn with it must outlive its runs.
+	*/
+	void Init(GlyphAtlas& atlas);
+
+	void Draw(SpriteBatch& batch, const Shader& shader, const Font& font, std::string_view text, u32 pixelHeight,
+	          const Vector2<f32>& position, const Color& color = Color(0xFF, 0xFF, 0xFF));
+
+	/**
+	* \brief Size of the laid out text: the widest line by the height of all lines.
+	*/
+	[[nodiscard]] Vector2<f32> Measure(const Font& font, std::string_view text, u32 pixelHeight);
+
+	/**
+	* \brief Drops unused runs and ends the atlas's frame. Call it after the batch the text was drawn with has been
+	* ended, since a full atlas is emptied here.
+	*/
+	void EndFrame();
+	void Clear();
+
+	[[nodiscard]] u32 GetCachedRunCount() const;
+
+	/**
+	* \brief Runs laid out since the last EndFrame(), as opposed to taken from the cache.
+	*/
+	[[nodiscard]] u32 GetLayoutCount() const;
+
+private:
+	struct Run
+	{
+	public:
+		std::string           text;
+		const Font*           font        = nullptr;
+		u32                   pixelHeight = 0;
+		u32                   generation  = 0;
+		Vector2<f32>          size        = Vector2<f32>(0.f);
+		std::vector<Vertex2D> quads;
+
+		// The quads as last drawn, moved to placedPosition and tinted placedColor
+		std::vector<Vertex2D> placed;
+		Vector2<f32>          placedPosition = Vector2<f32>(0.f);
+		Color                 placedColor;
+		bool                  placedValid = false;
+
+		bool used = false;
+	};
+
+	GlyphAtlas* _atlas = nullptr;
+
+	std::unordered_map<u64, Run> _runs;
+
+	u32 _layoutCount = 0;
+
+	Run& GetRun(const Font& font, std::string_view text, u32 pixelHeight);
+	void Layout(Run& run);
+};
+
+}
+
+#endif
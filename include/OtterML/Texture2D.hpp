@@ -8,6 +8,14 @@
 
 namespace oter
 {
+enum class TextureFormat : u8
+{
+	RGBA8,
+	RGBA16F,
+	Depth24Stencil8,
+	Depth32F,
+};
+
 class Texture2D
 {
 public:
@@ -20,12 +28,25 @@ public:
 	void Generate(u32 width, u32 height, const u8* data);
 	void Generate(const Vector2<u32>& size, const u8* data);
 
+	/**
+	* \brief Allocates storage in \p format. \p data may be null, as for render targets, and is otherwise read as RGBA8
+	* for color formats.
+	*/
+	void Generate(const Vector2<u32>& size, TextureFormat format, const u8* data = nullptr);
+
+	/**
+	* \brief Overwrites the region of \p size at \p position with RGBA8 \p data, keeping the rest of the texture.
+	*/
+	void Update(const Vector2<u32>& position, const Vector2<u32>& size, const u8* data);
+
 	void Delete();
 
 	void Bind() const;
 
 	u32 GetID() const;
 
+	TextureFormat GetFormat() const;
+
 	const Vector2<u32>& GetTextureSize() const;
 
 	const Vector2<u32>& GetFrameSize() const;
@@ -41,9 +62,10 @@ public:
 	void                  SetAnimationFrame(const std::string& animationName, u32 frameNumber, const AnimationFrame& frame);
 
 private:
-	u32          _id        = 0;
-	Vector2<u32> _size      = Vector2<u32>(0u);
-	Vector2<u32> _frameSize = Vector2<u32>(0u);
+	u32           _id        = 0;
+	Vector2<u32>  _size      = Vector2<u32>(0u);
+	Vector2<u32>  _frameSize = Vector2<u32>(0u);
+	TextureFormat _format    = TextureFormat::RGBA8;
 
 	std::unordered_map<std::string, Animation> _animations;
 };
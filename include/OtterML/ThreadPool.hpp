@@ -0,0 +1,67 @@
+#ifndef OTER_THREADPOOL_HPP
+#define OTER_THREADPOOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <OtterML/Common.hpp>
+
+namespace oter
+{
+
+/**
+* \brief Fixed set of worker threads for splitting data-parallel loops across cores.
+*/
+class ThreadPool
+{
+public:
+	using Job = std::function<void(u32 begin, u32 end)>;
+
+	/**
+	* \brief Starts \p workerCount threads. With 0, one less than the number of hardware threads is used, since the
+	* calling thread also takes part in every ParallelFor.
+	*/
+	explicit ThreadPool(u32 workerCount = 0);
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&)            = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	[[nodiscard]] u32 GetWorkerCount() const;
+
+	/**
+	* \brief Runs \p job over [0, count) in chunks of \p chunkSize and returns once every chunk has finished.
+	*
+	* Chunks are handed out dynamically, so which thread runs which chunk varies, but each chunk always covers the same
+	* range. Jobs that only write inside their own range therefore give the same result on every run. Jobs must not throw.
+	*/
+	void ParallelFor(u32 count, u32 chunkSize, const Job& job);
+
+private:
+	std::vector<std::thread> _workers;
+
+	std::mutex              _mutex;
+	std::condition_variable _wake;
+	std::condition_variable _done;
+
+	// Current ParallelFor, guarded by _mutex apart from the atomic counters
+	const Job*       _job        = nullptr;
+	u32              _count      = 0;
+	u32              _chunkSize  = 0;
+	u32              _chunkCount = 0;
+	u64              _generation = 0;
+	u32              _busy       = 0;
+	bool             _stopping   = false;
+	std::atomic<u32> _nextChunk  = 0;
+
+	void WorkerLoop();
+	void RunChunks();
+};
+
+}
+
+#endif
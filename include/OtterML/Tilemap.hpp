@@ -0,0 +1,113 @@
+#ifndef OTER_TILEMAP_HPP
+#define OTER_TILEMAP_HPP
+
+#include <vector>
+
+#include <OtterML/Vector2.hpp>
+#include <OtterML/Vertex2D.hpp>
+
+namespace oter
+{
+class Shader;
+class Texture2D;
+
+/**
+* \brief Grid of tiles drawn from a sprite sheet, split into CHUNK_SIZE x CHUNK_SIZE chunks with one static vertex
+* buffer each.
+*
+* Tiles index the frames of the tileset row by row, using its frame size (Texture2D::GetFrameSize()). EMPTY_TILE
+* leaves a cell blank and costs nothing to draw. Changing a tile only marks its chunk dirty. Draw() rebuilds dirty
+* chunks once they are in view, and issues one draw per visible chunk that has tiles, so a full screen of tiles takes
+* a handful of draws. All chunks share one index buffer.
+*
+* Tile (x, y) covers [x, x + 1) * tileSize by [y, y + 1) * tileSize in world space. The shader is expected to read the
+* Vertex2D layout, as SpriteBatch::VERTEX_SOURCE does.
+*/
+class Tilemap
+{
+public:
+	using Tile = u16;
+
+	static constexpr u32  CHUNK_SIZE = 32;
+	static constexpr Tile EMPTY_TILE = UINT16_MAX;
+
+	Tilemap();
+	~Tilemap();
+
+	/**
+	* \brief Creates an empty map of \p size tiles. \p tileset must outlive the map. Its frame size is read here, so
+	* changing it later takes another Init().
+	*
+	* Throws std::invalid_argument if the tileset's frame size is zero or larger than its texture, or if \p tileSize is
+	* not positive.
+	*/
+	void Init(const Vector2<u32>& size, const Texture2D& tileset, const Vector2<f32>& tileSize);
+	void Delete();
+
+	/**
+	* \brief Throws std::out_of_range if (\p x, \p y) is outside the map or \p tile is past the tileset's last frame.
+	*/
+	void               SetTile(u32 x, u32 y, Tile tile);
+	[[nodiscard]] Tile GetTile(u32 x, u32 y) const;
+
+	/**
+	* \brief Sets every tile of the map, e.g. when loading a level. Chunks that end up empty are not drawn. Throws
+	* std::out_of_range if \p tile is past the tileset's last frame.
+	*/
+	void Fill(Tile tile);
+
+	/**
+	* \brief Draws the chunks overlapping the world-space rectangle at \p viewPosition of \p viewSize.
+	*/
+	void Draw(const Shader& shader, const Vector2<f32>& viewPosition, const Vector2<f32>& viewSize);
+
+	[[nodiscard]] const Vector2<u32>& GetSize() const;
+	[[nodiscard]] Vector2<u32>        GetChunkCount() const;
+
+	/**
+	* \brief Draw calls issued by the last Draw(), one per visible chunk with tiles.
+	*/
+	[[nodiscard]] u32 GetDrawCallCount() const;
+
+	/**
+	* \brief Chunks rebuilt by the last Draw().
+	*/
+	[[nodiscard]] u32 GetRebuiltChunkCount() const;
+
+private:
+	struct Chunk
+	{
+	public:
+		u32  vao       = 0;
+		u32  vbo       = 0;
+		u32  quadCount = 0;
+		bool dirty     = false;
+	};
+
+	Vector2<u32>       _size;
+	Vector2<u32>       _chunkCount;
+	Vector2<f32>       _tileSize;
+	const Texture2D*   _tileset = nullptr;
+	std::vector<Tile>  _tiles;
+	std::vector<Chunk> _chunks;
+
+	// Tileset layout, taken at Init()
+	u32          _columns    = 0;
+	u32          _frameCount = 0;
+	Vector2<f32> _frameUV;
+
+	u32 _ibo = 0;
+
+	// Reused between rebuilds to avoid allocating
+	std::vector<Vertex2D> _scratch;
+
+	u32 _drawCallCount     = 0;
+	u32 _rebuiltChunkCount = 0;
+
+	Chunk& GetChunk(u32 x, u32 y);
+	void   Rebuild(Chunk& chunk, u32 chunkX, u32 chunkY);
+};
+
+}
+
+#endif
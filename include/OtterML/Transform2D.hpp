@@ -32,6 +32,22 @@ public:
 
 	Matrix<f32, 3, 3>& GetMatrix();
 
+	/**
+	* \brief Inverse of GetMatrix(), built directly from the rotation, scale, skew and translation.
+	*
+	* Rebuilt together with the matrix whenever the transform changes, so repeated calls are free.
+	* Returns a zero matrix if the scale or skew collapses the transform.
+	*/
+	Matrix<f32, 3, 3>& GetInverseMatrix();
+
+	/**
+	* \brief Builds the affine matrix for a rotation (given as its sine and cosine), scale, skew and translation.
+	*
+	* The linear part is rotation * skew * scale, where skew is the shear matrix [1 skewX; skewY 1].
+	*/
+	static Matrix<f32, 3, 3> Compose(f32 sine, f32 cosine, f32 scaleX, f32 scaleY, f32 skewX, f32 skewY,
+	                                 f32 translationX, f32 translationY);
+
 	bool operator==(const Transform2D& right) const;
 
 private:
@@ -42,8 +58,30 @@ private:
 
 	bool _changed = true;
 
-	Matrix<f32, 3, 3> _matrix = Matrix<f32, 3, 3>::IdentityMatrix;
+	Matrix<f32, 3, 3> _matrix        = Matrix<f32, 3, 3>::IdentityMatrix;
+	Matrix<f32, 3, 3> _inverseMatrix = Matrix<f32, 3, 3>::IdentityMatrix;
+
+	void Rebuild();
 };
+
+inline Matrix<f32, 3, 3> Transform2D::Compose(const f32 sine, const f32 cosine, const f32 scaleX, const f32 scaleY,
+                                              const f32 skewX, const f32 skewY,
+                                              const f32 translationX, const f32 translationY)
+{
+	const f32 m00 = (cosine + sine * skewY) * scaleX;
+	const f32 m01 = (cosine * skewX + sine) * scaleY;
+	const f32 m02 = translationX;
+
+	const f32 m10 = (cosine * skewY - sine) * scaleX;
+	const f32 m11 = (cosine - sine * skewX) * scaleY;
+	const f32 m12 = translationY;
+
+	constexpr f32 m20 = 0.f;
+	constexpr f32 m21 = 0.f;
+	constexpr f32 m22 = 1.f;
+
+	return Matrix<f32, 3, 3>(std::array{ m00, m01, m02, m10, m11, m12, m20, m21, m22 });
+}
 }
 
 #endif
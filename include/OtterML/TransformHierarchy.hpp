@@ -0,0 +1,93 @@
+#ifndef OTER_TRANSFORMHIERARCHY_HPP
+#define OTER_TRANSFORMHIERARCHY_HPP
+
+#include <vector>
+
+#include <OtterML/Transform2D.hpp>
+
+namespace oter
+{
+
+/**
+* \brief Parent/child tree of Transform2Ds with cached world and inverse-world matrices.
+*
+* Nodes are stored in flat arrays ordered so that every parent comes before its children, which lets Update() resolve the
+* whole tree in one forward pass. Only nodes whose local transform changed, and their descendants, are recomputed; nodes
+* before the first change are never touched.
+*
+* Node handles stay valid until the node is removed, even when the arrays are reordered.
+*/
+class TransformHierarchy
+{
+public:
+	using Node = u32;
+
+	static constexpr Node INVALID_NODE = UINT32_MAX;
+
+	TransformHierarchy();
+
+	Node Create(Node parent = INVALID_NODE);
+	Node Create(const Transform2D& local, Node parent = INVALID_NODE);
+
+	/**
+	* \brief Removes a node along with all of its descendants.
+	*/
+	void Remove(Node node);
+	void Clear();
+
+	[[nodiscard]] bool IsValid(Node node) const;
+	[[nodiscard]] u32  GetCount() const;
+
+	[[nodiscard]] Node GetParent(Node node) const;
+
+	/**
+	* \brief Moves a node, with its subtree, under a new parent. Throws if \p parent is \p node or one of its descendants.
+	*/
+	void SetParent(Node node, Node parent);
+
+	[[nodiscard]] const Transform2D& GetLocal(Node node) const;
+	void                             SetLocal(Node node, const Transform2D& local);
+
+	/**
+	* \brief Gives write access to a node's local transform and marks it as changed.
+	*/
+	Transform2D& EditLocal(Node node);
+
+	/**
+	* \brief Recomputes the world matrices of every changed node and its descendants.
+	*/
+	void Update();
+
+	/**
+	* \brief World matrix as of the last Update().
+	*/
+	[[nodiscard]] const Matrix<f32, 3, 3>& GetWorldMatrix(Node node) const;
+	[[nodiscard]] const Matrix<f32, 3, 3>& GetInverseWorldMatrix(Node node) const;
+
+private:
+	// Dense arrays, parent-before-child order
+	std::vector<u32>               _parents;
+	std::vector<Transform2D>       _locals;
+	std::vector<Matrix<f32, 3, 3>> _worlds;
+	std::vector<Matrix<f32, 3, 3>> _inverseWorlds;
+	std::vector<u8>                _localDirty;
+	std::vector<u8>                _worldDirty;
+	std::vector<Node>              _nodes;
+
+	// Node handle -> dense index
+	std::vector<u32>  _indices;
+	std::vector<Node> _freeNodes;
+
+	u32 _firstDirty = 0;
+
+	[[nodiscard]] u32 GetIndex(Node node) const;
+
+	void MarkDirty(u32 index);
+
+	// Stable partition of the dense arrays by keep[i], with the dropped entries either discarded or appended at the end
+	void Compact(const std::vector<u8>& keep, bool moveDroppedToEnd);
+};
+
+}
+
+#endif
@@ -0,0 +1,156 @@
+#ifndef OTER_TRANSFORMSTORE_HPP
+#define OTER_TRANSFORMSTORE_HPP
+
+#include <span>
+#include <vector>
+
+#include <OtterML/AlignedAllocator.hpp>
+#include <OtterML/Transform2D.hpp>
+
+namespace oter
+{
+
+class ThreadPool;
+
+/**
+* \brief Structure-of-arrays storage for many 2D transforms, rebuilt in bulk.
+*
+* Rotation, scale, skew and translation each live in their own tightly packed array, and changed transforms are tracked
+* in a bitset. RebuildDirty() runs the batched SinCos over every changed rotation and composes the matrices in one pass,
+* which replaces calling Transform2D::GetMatrix() object by object.
+*
+* RebuildDirty() and Interpolate() can also be split across a ThreadPool. The arrays are cache line aligned and the work
+* is cut into chunks of PARALLEL_CHUNK_SIZE transforms, which always start on a cache line boundary for every array,
+* including the dirty bitset, so threads never write to the same line.
+*
+* Transforms are referred to by handles, which stay valid until the transform is destroyed even though the arrays are
+* kept dense by swapping the last element into freed spots.
+*/
+class TransformStore
+{
+public:
+	struct Handle
+	{
+	public:
+		u32 Slot       = UINT32_MAX;
+		u32 Generation = 0;
+
+		friend bool operator==(const Handle& left, const Handle& right) = default;
+	};
+
+	static constexpr u32 PARALLEL_CHUNK_SIZE = 512;
+
+	TransformStore();
+
+	Handle Create();
+	Handle Create(const Transform2D& transform);
+	void   Destroy(Handle handle);
+	void   Clear();
+
+	void Reserve(u32 capacity);
+
+	[[nodiscard]] bool IsValid(Handle handle) const;
+	[[nodiscard]] u32  GetCount() const;
+
+	[[nodiscard]] Angle        GetRotation(Handle handle) const;
+	[[nodiscard]] Vector2<f32> GetScale(Handle handle) const;
+	[[nodiscard]] Vector2<f32> GetSkew(Handle handle) const;
+	[[nodiscard]] Vector2<f32> GetTranslation(Handle handle) const;
+
+	void SetRotation(Handle handle, const Angle& newRotation);
+	void SetScale(Handle handle, const Vector2<f32>& newScale);
+	void SetScale(Handle handle, const f32& newScaleScalar);
+	void SetSkew(Handle handle, const Vector2<f32>& newSkew);
+	void SetTranslation(Handle handle, const Vector2<f32>& newTranslation);
+
+	void Rotate(Handle handle, const Angle& rotationChange);
+	void Scale(Handle handle, const Vector2<f32>& scaleChange);
+	void Translate(Handle handle, const Vector2<f32>& translationChange);
+
+	/**
+	* \brief Recomputes the matrix of every transform changed since the last call.
+	*/
+	void RebuildDirty();
+	void RebuildDirty(ThreadPool& pool);
+
+	/**
+	* \brief Matrix as of the last RebuildDirty().
+	*/
+	[[nodiscard]] const Matrix<f32, 3, 3>& GetMatrix(Handle handle) const;
+
+	/**
+	* \brief All matrices in dense order, for bulk uploads.
+	*/
+	[[nodiscard]] std::span<const Matrix<f32, 3, 3>> GetMatrices() const;
+
+	/**
+	* \brief Snapshots the current rotation, scale, skew and translation of every transform as the previous state.
+	*
+	* Call once at the start of each fixed simulation step, before the step changes anything.
+	*/
+	void SaveState();
+
+	/**
+	* \brief Makes a transform's previous state equal to its current one, so the next Interpolate() does not blend across a teleport.
+	*/
+	void ResetInterpolation(Handle handle);
+
+	/**
+	* \brief Blends every transform between its previous and current state and writes the results as render matrices.
+	*
+	* \p alpha is how far the renderer is between the last two simulation steps, 0 being the previous step and 1 the current one.
+	* Rotation blends along the shortest arc.
+	*/
+	void Interpolate(f32 alpha);
+	void Interpolate(f32 alpha, ThreadPool& pool);
+
+	/**
+	* \brief Render matrix as of the last Interpolate().
+	*/
+	[[nodiscard]] const Matrix<f32, 3, 3>& GetRenderMatrix(Handle handle) const;
+
+	[[nodiscard]] std::span<const Matrix<f32, 3, 3>> GetRenderMatrices() const;
+
+private:
+	// Dense SoA arrays, rotations in radians
+	CacheAlignedVector<f32>               _rotations;
+	CacheAlignedVector<f32>               _scalesX;
+	CacheAlignedVector<f32>               _scalesY;
+	CacheAlignedVector<f32>               _skewsX;
+	CacheAlignedVector<f32>               _skewsY;
+	CacheAlignedVector<f32>               _translationsX;
+	CacheAlignedVector<f32>               _translationsY;
+	CacheAlignedVector<Matrix<f32, 3, 3>> _matrices;
+	CacheAlignedVector<u64>               _dirty;
+	std::vector<u32>                      _slotOfIndex;
+
+	// State as of the last SaveState(), in the same dense order
+	CacheAlignedVector<f32>               _previousRotations;
+	CacheAlignedVector<f32>               _previousScalesX;
+	CacheAlignedVector<f32>               _previousScalesY;
+	CacheAlignedVector<f32>               _previousSkewsX;
+	CacheAlignedVector<f32>               _previousSkewsY;
+	CacheAlignedVector<f32>               _previousTranslationsX;
+	CacheAlignedVector<f32>               _previousTranslationsY;
+	CacheAlignedVector<Matrix<f32, 3, 3>> _renderMatrices;
+
+	// Scratch space for Interpolate()
+	CacheAlignedVector<f32> _blendRotations;
+	CacheAlignedVector<f32> _blendSines;
+	CacheAlignedVector<f32> _blendCosines;
+
+	// Handle slot -> dense index
+	std::vector<u32> _indices;
+	std::vector<u32> _generations;
+	std::vector<u32> _freeSlots;
+
+	[[nodiscard]] u32 GetIndex(Handle handle) const;
+
+	void MarkDirty(u32 index);
+	void RebuildWord(u32 word);
+	void InterpolateRange(f32 alpha, u32 begin, u32 end);
+};
+
+}
+
+#endif
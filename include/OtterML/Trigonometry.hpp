@@ -0,0 +1,88 @@
+#ifndef OTER_TRIGONOMETRY_HPP
+#define OTER_TRIGONOMETRY_HPP
+
+#include <span>
+
+#include <OtterML/Angle.hpp>
+
+namespace oter
+{
+
+/**
+* \brief Accuracy of the polynomial sine/cosine kernel.
+*
+* Fast uses degree 5/4 polynomials (max error ~1.5e-5), Precise uses degree 7/8 polynomials (within a couple of ulp of libm).
+* Both are accurate for |radians| up to ~8000; past that the range reduction starts losing bits.
+*/
+enum class TrigPrecision : u8
+{
+	Fast,
+	Precise,
+};
+
+template <TrigPrecision P>
+inline void SinCosKernel(const f32 radians, f32& sine, f32& cosine)
+{
+	// Round to the nearest quadrant with the 1.5 * 2^23 trick, which vectorizes without SSE4.1
+	constexpr f32 roundMagic = 12582912.f;
+	const f32     quadrant   = (radians * static_cast<f32>(2.0 / PI) + roundMagic) - roundMagic;
+	const i32     q          = static_cast<i32>(quadrant);
+
+	// Cody-Waite reduction into [-pi/4, pi/4], pi/2 split into three exactly representable parts
+	f32 x = radians - quadrant * 1.5703125f;
+	x     = x - quadrant * 4.837512969970703125e-4f;
+	x     = x - quadrant * 7.54978995489188216e-8f;
+
+	const f32 x2 = x * x;
+
+	f32 s;
+	f32 c;
+	if constexpr (P == TrigPrecision::Fast)
+	{
+		s = x + x * x2 * (-1.6662833749e-1f + x2 * 8.1529912936e-3f);
+		c = 1.f + x2 * (-4.9977630416e-1f + x2 * 4.0488930400e-2f);
+	}
+	else
+	{
+		s = x + x * x2 * (-1.6666654611e-1f + x2 * (8.3321608736e-3f + x2 * -1.9515295891e-4f));
+		c = 1.f + x2 * (-0.5f + x2 * (4.166664568298827e-2f + x2 * (-1.388731625493765e-3f + x2 * 2.443315711809948e-5f)));
+	}
+
+	// Odd quadrants swap sine and cosine, quadrants 2/3 negate sine and 1/2 negate cosine
+	const bool swap = (q & 1) != 0;
+	const f32  rs   = swap ? c : s;
+	const f32  rc   = swap ? s : c;
+
+	sine   = (q & 2) != 0 ? -rs : rs;
+	cosine = ((q + 1) & 2) != 0 ? -rc : rc;
+}
+
+/**
+* \brief Computes the sine and cosine of an angle in radians with a single range reduction.
+*/
+inline void SinCos(const f32 radians, f32& sine, f32& cosine, const TrigPrecision precision = TrigPrecision::Precise)
+{
+	if (precision == TrigPrecision::Fast)
+		SinCosKernel<TrigPrecision::Fast>(radians, sine, cosine);
+	else
+		SinCosKernel<TrigPrecision::Precise>(radians, sine, cosine);
+}
+
+inline void SinCos(const Angle& angle, f32& sine, f32& cosine, const TrigPrecision precision = TrigPrecision::Precise)
+{
+	SinCos(angle.GetRadians(), sine, cosine, precision);
+}
+
+/**
+* \brief Computes the sine and cosine of every value in \p radians. The loop is branch-free so the compiler can vectorize it.
+*
+* \p sinOut and \p cosOut must be at least as long as the input.
+*/
+void SinCos(std::span<const f32> radians, std::span<f32> sinOut, std::span<f32> cosOut,
+            TrigPrecision precision = TrigPrecision::Precise);
+void SinCos(std::span<const Angle> angles, std::span<f32> sinOut, std::span<f32> cosOut,
+            TrigPrecision precision = TrigPrecision::Precise);
+
+}
+
+#endif
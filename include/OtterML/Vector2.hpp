@@ -1,6 +1,7 @@
 #ifndef OTER_VECTOR2_HPP
 #define OTER_VECTOR2_HPP
 
+#include <array>
 #include <cmath>
 #include <stdexcept>
 
@@ -0,0 +1,34 @@
+#ifndef OTER_VERTEX2D_HPP
+#define OTER_VERTEX2D_HPP
+
+#include <OtterML/Color.hpp>
+#include <OtterML/Common.hpp>
+
+namespace oter
+{
+
+/**
+* \brief Vertex layout shared by the batched 2D renderers: position, texture coordinates and a packed RGBA8 color.
+*
+* Bound as attribute 0 (vec2 position), 1 (vec2 texture coordinates) and 2 (normalized vec4 color).
+*/
+struct Vertex2D
+{
+public:
+	f32   X    = 0.f;
+	f32   Y    = 0.f;
+	f32   U    = 0.f;
+	f32   V    = 0.f;
+	Color Tint = Color(0xFF, 0xFF, 0xFF);
+
+	/**
+	* \brief Sets up attributes 0-2 of the currently bound vertex array for the currently bound GL_ARRAY_BUFFER.
+	*/
+	static void SetAttributes();
+};
+
+static_assert(sizeof(Vertex2D) == 20, "oter::Vertex2D must stay tightly packed for GPU uploads.");
+
+}
+
+#endif
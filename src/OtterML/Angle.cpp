@@ -7,8 +7,6 @@ namespace oter
 
 const Angle Angle::Zero(0.f);
 
-constexpr Angle::Angle() : _degrees(0.f) { }
-
 void Angle::SetDegrees(f32 degrees)
 {
 	this->_degrees = degrees;
@@ -0,0 +1,37 @@
+#include <OtterML/BinaryAngle.hpp>
+
+namespace oter
+{
+
+// Evaluated at compile time with a Taylor series instead of std::sin, so the table does not depend on the platform's libm
+static constexpr f64 ConstexprSin(f64 x)
+{
+	// Reduce into [-pi, pi], where 24 terms converge to double precision
+	while (x > PI)
+		x -= 2.0 * PI;
+	while (x < -PI)
+		x += 2.0 * PI;
+
+	f64 term = x;
+	f64 sum  = x;
+	for (i32 n = 1; n < 24; n++)
+	{
+		term *= -x * x / static_cast<f64>((2 * n) * (2 * n + 1));
+		sum += term;
+	}
+	return sum;
+}
+
+static constexpr std::array<f32, BINARY_ANGLE_TABLE_SIZE + 1> GenerateSineTable()
+{
+	std::array<f32, BINARY_ANGLE_TABLE_SIZE + 1> table{};
+	for (u32 i = 0; i <= BINARY_ANGLE_TABLE_SIZE; i++)
+	{
+		table[i] = static_cast<f32>(ConstexprSin(2.0 * PI * static_cast<f64>(i) / BINARY_ANGLE_TABLE_SIZE));
+	}
+	return table;
+}
+
+constexpr std::array<f32, BINARY_ANGLE_TABLE_SIZE + 1> BINARY_ANGLE_SINE_TABLE = GenerateSineTable();
+
+}
@@ -0,0 +1,696 @@
+#include <OtterML/Font.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#include <OtterML/Profiler.hpp>
+
+namespace oter
+{
+
+// Composite glyphs nest other glyphs; real fonts stay a few levels deep, so anything deeper is malformed
+static constexpr u32 MAX_COMPOSITE_DEPTH = 8;
+
+Font::Font() {}
+
+Font::~Font() {}
+
+void Font::LoadFromFile(const std::string& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file)
+		throw std::runtime_error("Font could not open " + path + ".");
+
+	this->LoadFromMemory(std::vector<u8>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()));
+}
+
+void Font::LoadFromMemory(std::vector<u8> data)
+{
+	this->_data = std::move(data);
+
+	// A collection lists its fonts after the header; only the first one is used
+	u32 fontOffset = 0;
+	if (this->_data.size() >= 16 && std::memcmp(this->_data.data(), "ttcf", 4) == 0)
+		fontOffset = this->ReadU32(12);
+
+	const u32 version = this->ReadU32(fontOffset);
+	if (version != 0x00010000 && version != 0x74727565)
+		throw std::runtime_error("Font data is not a TrueType font.");
+
+	const u32 head = this->FindTable(fontOffset, "head");
+	const u32 hhea = this->FindTable(fontOffset, "hhea");
+	const u32 maxp = this->FindTable(fontOffset, "maxp");
+	const u32 cmap = this->FindTable(fontOffset, "cmap");
+	this->_hmtx    = this->FindTable(fontOffset, "hmtx");
+	this->_loca    = this->FindTable(fontOffset, "loca");
+	this->_glyf    = this->FindTable(fontOffset, "glyf");
+	if (head == 0 || hhea == 0 || maxp == 0 || cmap == 0 || this->_hmtx == 0 || this->_loca == 0 || this->_glyf == 0)
+		throw std::runtime_error("Font is missing a required table, or has CFF outlines.");
+
+	this->_longLoca     = this->ReadI16(head + 50) != 0;
+	this->_glyphCount   = this->ReadU16(maxp + 4);
+	this->_ascender     = this->ReadI16(hhea + 4);
+	this->_descender    = this->ReadI16(hhea + 6);
+	this->_lineGap      = this->ReadI16(hhea + 8);
+	this->_hMetricCount = this->ReadU16(hhea + 34);
+
+	this->ReadCMap(cmap);
+
+	u32       kernLength = 0;
+	const u32 kern       = this->FindTable(fontOffset, "kern", &kernLength);
+	this->_kernPairs     = 0;
+	this->_kernCount     = 0;
+	if (kern != 0)
+		this->ReadKern(kern, kernLength);
+}
+
+u32 Font::GetGlyphIndex(const u32 codepoint) const
+{
+	if (this->_cmap == 0)
+		return 0;
+
+	const u32 format = this->ReadU16(this->_cmap);
+	if (format == 4)
+	{
+		if (codepoint > 0xFFFF)
+			return 0;
+
+		const u32 segmentCount = this->ReadU16(this->_cmap + 6) / 2;
+		const u32 endCodes     = this->_cmap + 14;
+		const u32 startCodes   = endCodes + segmentCount * 2 + 2;
+		const u32 deltas       = startCodes + segmentCount * 2;
+		const u32 rangeOffsets = deltas + segmentCount * 2;
+
+		// Segments are sorted by end code, so the first one ending at or after the character is the only candidate
+		u32 low  = 0;
+		u32 high = segmentCount;
+		while (low < high)
+		{
+			const u32 middle = (low + high) / 2;
+			if (this->ReadU16(endCodes + middle * 2) < codepoint)
+				low = middle + 1;
+			else
+				high = middle;
+		}
+		if (low == segmentCount)
+			return 0;
+
+		const u32 start = this->ReadU16(startCodes + low * 2);
+		if (codepoint < start)
+			return 0;
+
+		const u32 delta       = this->ReadU16(deltas + low * 2);
+		const u32 rangeOffset = this->ReadU16(rangeOffsets + low * 2);
+		if (rangeOffset == 0)
+			return (codepoint + delta) & 0xFFFF;
+
+		// The offset is relative to where it is stored
+		const u32 glyph = this->ReadU16(rangeOffsets + low * 2 + rangeOffset + (codepoint - start) * 2);
+		return glyph == 0 ? 0 : (glyph + delta) & 0xFFFF;
+	}
+
+	if (format == 12)
+	{
+		const u32 groupCount = this->ReadU32(this->_cmap + 12);
+		const u32 groups     = this->_cmap + 16;
+
+		u32 low  = 0;
+		u32 high = groupCount;
+		while (low < high)
+		{
+			const u32 middle = (low + high) / 2;
+			const u32 group  = groups + middle * 12;
+			if (codepoint < this->ReadU32(group))
+				high = middle;
+			else if (codepoint > this->ReadU32(group + 4))
+				low = middle + 1;
+			else
+				return this->ReadU32(group + 8) + codepoint - this->ReadU32(group);
+		}
+	}
+
+	return 0;
+}
+
+i32 Font::GetAdvance(const u32 glyph) const
+{
+	if (this->_hMetricCount == 0)
+		return 0;
+
+	// Glyphs past the last long metric share its advance
+	return this->ReadU16(this->_hmtx + std::min(glyph, this->_hMetricCount - 1) * 4);
+}
+
+i32 Font::GetKerning(const u32 left, const u32 right) const
+{
+	// Pairs are sorted by the left and right glyph packed together
+	const u32 key  = left << 16 | right;
+	u32       low  = 0;
+	u32       high = this->_kernCount;
+	while (low < high)
+	{
+		const u32 middle = (low + high) / 2;
+		const u32 pair   = this->_kernPairs + middle * 6;
+		const u32 found  = this->ReadU32(pair);
+		if (found < key)
+			low = middle + 1;
+		else if (found > key)
+			high = middle;
+		else
+			return this->ReadI16(pair + 4);
+	}
+	return 0;
+}
+
+i32 Font::GetAscender() const
+{
+	return this->_ascender;
+}
+
+i32 Font::GetDescender() const
+{
+	return this->_descender;
+}
+
+i32 Font::GetLineGap() const
+{
+	return this->_lineGap;
+}
+
+u32 Font::GetGlyphCount() const
+{
+	return this->_glyphCount;
+}
+
+f32 Font::GetScale(const f32 pixelHeight) const
+{
+	const i32 height = this->_ascender - this->_descender;
+	return height > 0 ? pixelHeight / static_cast<f32>(height) : 0.f;
+}
+
+GlyphBitmap Font::Rasterize(const u32 glyph, const f32 pixelHeight) const
+{
+	OTTERML_PROFILE_ZONE("Font::Rasterize");
+
+	GlyphBitmap bitmap;
+
+	u32 offset = 0;
+	u32 length = 0;
+	if (!this->GetGlyphRange(glyph, offset, length))
+		return bitmap;
+
+	// The header's bounds cover composite glyphs too
+	const f32 scale = this->GetScale(pixelHeight);
+	const i32 left  = static_cast<i32>(std::floor(this->ReadI16(offset + 2) * scale));
+	const i32 top   = static_cast<i32>(std::ceil(this->ReadI16(offset + 8) * scale));
+	const i32 right = static_cast<i32>(std::ceil(this->ReadI16(offset + 6) * scale));
+	const i32 under = static_cast<i32>(std::floor(this->ReadI16(offset + 4) * scale));
+	if (right <= left || top <= under)
+		return bitmap;
+
+	bitmap.Size   = Vector2<u32>(static_cast<u32>(right - left), static_cast<u32>(top - under));
+	bitmap.Offset = Vector2<i32>(left, -top);
+
+	// Font units to bitmap pixels, flipping y so rows run top to bottom
+	const f32 transform[6] = { scale, 0.f, -static_cast<f32>(left), 0.f, -scale, static_cast<f32>(top) };
+
+	std::vector<Point> points;
+	std::vector<u32>   contourEnds;
+	this->AppendOutline(glyph, transform, 1.f / scale, points, contourEnds, 0);
+
+	// Signed area accumulation: every edge adds the area it covers to the right of itself within a row to the cells it
+	// crosses, and the running sum along the row is the coverage. Edges are clamped to the bitmap, which they only leave
+	// by rounding
+	const u32        width  = bitmap.Size.X;
+	const u32        height = bitmap.Size.Y;
+	const f32        maxX   = static_cast<f32>(width);
+	const f32        maxY   = static_cast<f32>(height);
+	std::vector<f32> accumulation(static_cast<size_t>(width) * height + 2, 0.f);
+
+	const auto drawLine = [&](Point from, Point to)
+	{
+		from.x = std::clamp(from.x, 0.f, maxX);
+		from.y = std::clamp(from.y, 0.f, maxY);
+		to.x   = std::clamp(to.x, 0.f, maxX);
+		to.y   = std::clamp(to.y, 0.f, maxY);
+		if (from.y == to.y)
+			return;
+
+		f32 direction = 1.f;
+		if (from.y > to.y)
+		{
+			std::swap(from, to);
+			direction = -1.f;
+		}
+
+		const f32 dxdy = (to.x - from.x) / (to.y - from.y);
+		f32       x    = from.x;
+		const u32 end  = std::min(static_cast<u32>(std::ceil(to.y)), height);
+		for (u32 y = static_cast<u32>(from.y); y < end; y++)
+		{
+			f32* row = accumulation.data() + static_cast<size_t>(y) * width;
+
+			const f32 dy    = std::min(static_cast<f32>(y + 1), to.y) - std::max(static_cast<f32>(y), from.y);
+			const f32 xNext = x + dxdy * dy;
+			const f32 d     = dy * direction;
+			const f32 x0    = std::min(x, xNext);
+			const f32 x1    = std::max(x, xNext);
+			const f32 x0f   = std::floor(x0);
+			const u32 x0i   = static_cast<u32>(x0f);
+			const u32 x1i   = static_cast<u32>(std::ceil(x1));
+
+			if (x1i <= x0i + 1)
+			{
+				// Within one cell, split by the midpoint of the edge
+				const f32 middle = 0.5f * (x + xNext) - x0f;
+				row[x0i] += d - d * middle;
+				row[x0i + 1] += d * middle;
+			}
+			else
+			{
+				// Across cells, the covered area grows linearly between a triangle at each end
+				const f32 s      = 1.f / (x1 - x0);
+				const f32 x0frac = x0 - x0f;
+				const f32 a0     = 0.5f * s * (1.f - x0frac) * (1.f - x0frac);
+				const f32 x1frac = x1 - std::ceil(x1) + 1.f;
+				const f32 aEnd   = 0.5f * s * x1frac * x1frac;
+				row[x0i] += d * a0;
+				if (x1i == x0i + 2)
+				{
+					row[x0i + 1] += d * (1.f - a0 - aEnd);
+				}
+				else
+				{
+					const f32 a1 = s * (1.5f - x0frac);
+					row[x0i + 1] += d * (a1 - a0);
+					for (u32 xi = x0i + 2; xi < x1i - 1; xi++)
+					{
+						row[xi] += d * s;
+					}
+					const f32 a2 = a1 + static_cast<f32>(x1i - x0i - 3) * s;
+					row[x1i - 1] += d * (1.f - a2 - aEnd);
+				}
+				row[x1i] += d * aEnd;
+			}
+			x = xNext;
+		}
+	};
+
+	u32 contourStart = 0;
+	for (const u32 contourEnd : contourEnds)
+	{
+		for (u32 i = contourStart; i < contourEnd; i++)
+		{
+			drawLine(points[i], points[i + 1 < contourEnd ? i + 1 : contourStart]);
+		}
+		contourStart = contourEnd;
+	}
+
+	// A closed outline adds up to zero across every row, so the sum can run over the whole buffer
+	bitmap.Coverage.resize(static_cast<size_t>(width) * height);
+	f32 sum = 0.f;
+	for (size_t i = 0; i < bitmap.Coverage.size(); i++)
+	{
+		sum += accumulation[i];
+		bitmap.Coverage[i] = static_cast<u8>(std::min(std::abs(sum), 1.f) * 255.f + 0.5f);
+	}
+
+	return bitmap;
+}
+
+u32 Font::FindTable(const u32 fontOffset, const char* tag, u32* length) const
+{
+	const u32 wanted = static_cast<u32>(static_cast<u8>(tag[0])) << 24 | static_cast<u32>(static_cast<u8>(tag[1])) << 16
+	                 | static_cast<u32>(static_cast<u8>(tag[2])) << 8 | static_cast<u8>(tag[3]);
+
+	for (u32 i = 0, count = this->ReadU16(fontOffset + 4); i < count; i++)
+	{
+		const u32 record = fontOffset + 12 + i * 16;
+		if (this->ReadU32(record) != wanted)
+			continue;
+
+		if (length != nullptr)
+			*length = this->ReadU32(record + 12);
+		return this->ReadU32(record + 8);
+	}
+	return 0;
+}
+
+void Font::ReadCMap(const u32 offset)
+{
+	// Prefer the full Unicode table, then the Basic Multilingual Plane one
+	u32 best     = 0;
+	u32 bestRank = 0;
+	for (u32 i = 0, count = this->ReadU16(offset + 2); i < count; i++)
+	{
+		const u32 record   = offset + 4 + i * 8;
+		const u32 platform = this->ReadU16(record);
+		const u32 encoding = this->ReadU16(record + 2);
+		const u32 table    = offset + this->ReadU32(record + 4);
+		const u32 format   = this->ReadU16(table);
+
+		u32 rank = 0;
+		if (format == 12 && (platform == 0 || (platform == 3 && encoding == 10)))
+			rank = 2;
+		else if (format == 4 && (platform == 0 || (platform == 3 && encoding == 1)))
+			rank = 1;
+
+		if (rank > bestRank)
+		{
+			best     = table;
+			bestRank = rank;
+		}
+	}
+
+	if (best == 0)
+		throw std::runtime_error("Font has no Unicode character map.");
+
+	this->_cmap = best;
+}
+
+void Font::ReadKern(const u32 offset, const u32 length)
+{
+	if (length < 4 || this->ReadU16(offset) != 0)
+		return;
+
+	// Only the first horizontal format 0 subtable is used, which is the common layout of legacy kern tables
+	u32 subtable = offset + 4;
+	for (u32 i = 0, count = this->ReadU16(offset + 2); i < count; i++)
+	{
+		const u32 coverage = this->ReadU16(subtable + 4);
+		if ((coverage & 0xFF01) == 0x0001 && (coverage & 0x0004) == 0)
+		{
+			this->_kernCount = this->ReadU16(subtable + 6);
+			this->_kernPairs = subtable + 14;
+			return;
+		}
+		subtable += this->ReadU16(subtable + 2);
+	}
+}
+
+bool Font::GetGlyphRange(const u32 glyph, u32& offset, u32& length) const
+{
+	if (glyph >= this->_glyphCount)
+		return false;
+
+	u32 start = 0;
+	u32 end   = 0;
+	if (this->_longLoca)
+	{
+		start = this->ReadU32(this->_loca + glyph * 4);
+		end   = this->ReadU32(this->_loca + glyph * 4 + 4);
+	}
+	else
+	{
+		start = this->ReadU16(this->_loca + glyph * 2) * 2u;
+		end   = this->ReadU16(this->_loca + glyph * 2 + 2) * 2u;
+	}
+
+	// Glyphs without an outline, such as space, have no data
+	if (end <= start)
+		return false;
+
+	offset = this->_glyf + start;
+	length = end - start;
+	return true;
+}
+
+void Font::AppendOutline(const u32 glyph, const f32 transform[6], const f32 tolerance, std::vector<Point>& points,
+                         std::vector<u32>& contourEnds, const u32 depth) const
+{
+	u32 offset = 0;
+	u32 length = 0;
+	if (depth > MAX_COMPOSITE_DEPTH || !this->GetGlyphRange(glyph, offset, length))
+		return;
+
+	const auto place = [&](const f32 x, const f32 y)
+	{
+		return Point{
+			transform[0] * x + transform[1] * y + transform[2],
+			transform[3] * x + transform[4] * y + transform[5],
+		};
+	};
+
+	const i16 contourCount = this->ReadI16(offset);
+	if (contourCount < 0)
+	{
+		constexpr u16 wordArguments = 0x0001;
+		constexpr u16 xyValues      = 0x0002;
+		constexpr u16 hasScale      = 0x0008;
+		constexpr u16 moreParts     = 0x0020;
+		constexpr u16 xyScale       = 0x0040;
+		constexpr u16 twoByTwo      = 0x0080;
+
+		u32 cursor = offset + 10;
+		u16 flags  = moreParts;
+		while (flags & moreParts)
+		{
+			flags                = this->ReadU16(cursor);
+			const u32 component  = this->ReadU16(cursor + 2);
+			cursor              += 4;
+
+			f32 dx = 0.f;
+			f32 dy = 0.f;
+			if (flags & wordArguments)
+			{
+				dx      = this->ReadI16(cursor);
+				dy      = this->ReadI16(cursor + 2);
+				cursor += 4;
+			}
+			else
+			{
+				dx      = static_cast<i8>(this->ReadU8(cursor));
+				dy      = static_cast<i8>(this->ReadU8(cursor + 1));
+				cursor += 2;
+			}
+			// Components placed by matching points are rare and left unmoved
+			if (!(flags & xyValues))
+			{
+				dx = 0.f;
+				dy = 0.f;
+			}
+
+			f32 a = 1.f;
+			f32 b = 0.f;
+			f32 c = 0.f;
+			f32 d = 1.f;
+			if (flags & hasScale)
+			{
+				a       = this->ReadI16(cursor) / 16384.f;
+				d       = a;
+				cursor += 2;
+			}
+			else if (flags & xyScale)
+			{
+				a       = this->ReadI16(cursor) / 16384.f;
+				d       = this->ReadI16(cursor + 2) / 16384.f;
+				cursor += 4;
+			}
+			else if (flags & twoByTwo)
+			{
+				a       = this->ReadI16(cursor) / 16384.f;
+				b       = this->ReadI16(cursor + 2) / 16384.f;
+				c       = this->ReadI16(cursor + 4) / 16384.f;
+				d       = this->ReadI16(cursor + 6) / 16384.f;
+				cursor += 8;
+			}
+
+			// Component space to glyph space, then on to the bitmap
+			const f32 combined[6] = {
+				transform[0] * a + transform[1] * b,
+				transform[0] * c + transform[1] * d,
+				transform[0] * dx + transform[1] * dy + transform[2],
+				transform[3] * a + transform[4] * b,
+				transform[3] * c + transform[4] * d,
+				transform[3] * dx + transform[4] * dy + transform[5],
+			};
+			this->AppendOutline(component, combined, tolerance, points, contourEnds, depth + 1);
+		}
+		return;
+	}
+
+	constexpr u8 onCurve    = 0x01;
+	constexpr u8 xShort     = 0x02;
+	constexpr u8 yShort     = 0x04;
+	constexpr u8 repeat     = 0x08;
+	constexpr u8 xSameOrPos = 0x10;
+	constexpr u8 ySameOrPos = 0x20;
+
+	const u32 endPoints  = offset + 10;
+	const u32 pointCount = contourCount == 0 ? 0 : this->ReadU16(endPoints + (contourCount - 1) * 2) + 1u;
+	u32       cursor     = endPoints + contourCount * 2;
+	cursor              += 2 + this->ReadU16(cursor);
+
+	std::vector<u8> flags(pointCount);
+	for (u32 i = 0; i < pointCount;)
+	{
+		const u8 flag = this->ReadU8(cursor++);
+		u32      runs = 1;
+		if (flag & repeat)
+			runs += this->ReadU8(cursor++);
+
+		for (; runs > 0 && i < pointCount; runs--)
+		{
+			flags[i++] = flag;
+		}
+	}
+
+	// Coordinates are deltas, all x first and then all y
+	std::vector<Point> outline(pointCount);
+	i32                value = 0;
+	for (u32 i = 0; i < pointCount; i++)
+	{
+		if (flags[i] & xShort)
+		{
+			const u8 delta  = this->ReadU8(cursor++);
+			value          += (flags[i] & xSameOrPos) ? delta : -delta;
+		}
+		else if (!(flags[i] & xSameOrPos))
+		{
+			value  += this->ReadI16(cursor);
+			cursor += 2;
+		}
+		outline[i].x = static_cast<f32>(value);
+	}
+	value = 0;
+	for (u32 i = 0; i < pointCount; i++)
+	{
+		if (flags[i] & yShort)
+		{
+			const u8 delta  = this->ReadU8(cursor++);
+			value          += (flags[i] & ySameOrPos) ? delta : -delta;
+		}
+		else if (!(flags[i] & ySameOrPos))
+		{
+			value  += this->ReadI16(cursor);
+			cursor += 2;
+		}
+		outline[i].y = static_cast<f32>(value);
+	}
+
+	const auto addCurve = [&](const Point& from, const Point& control, const Point& to)
+	{
+		// Enough segments that the flattened curve stays within about a third of a pixel
+		const f32 ex    = (from.x - 2.f * control.x + to.x) / tolerance;
+		const f32 ey    = (from.y - 2.f * control.y + to.y) / tolerance;
+		const f32 error = ex * ex + ey * ey;
+		const u32 steps = error < 0.333f ? 1u : 1u + static_cast<u32>(std::sqrt(std::sqrt(3.f * error)));
+		for (u32 step = 1; step <= steps; step++)
+		{
+			const f32 t = static_cast<f32>(step) / static_cast<f32>(steps);
+			const f32 u = 1.f - t;
+			points.push_back(place(u * u * from.x + 2.f * u * t * control.x + t * t * to.x,
+			                       u * u * from.y + 2.f * u * t * control.y + t * t * to.y));
+		}
+	};
+	const auto middle = [](const Point& left, const Point& right)
+	{
+		return Point{ 0.5f * (left.x + right.x), 0.5f * (left.y + right.y) };
+	};
+
+	u32 first = 0;
+	for (i32 contour = 0; contour < contourCount; contour++)
+	{
+		const u32 last = std::min<u32>(this->ReadU16(endPoints + contour * 2), pointCount - 1);
+		if (last < first)
+			continue;
+
+		// Start on a point of the curve; between two control points the curve passes through their middle
+		const u32 count = last - first + 1;
+		Point     start;
+		u32       next = 0;
+		u32       end  = count;
+		if (flags[first] & onCurve)
+		{
+			start = outline[first];
+			next  = 1;
+		}
+		else if (flags[last] & onCurve)
+		{
+			start = outline[last];
+			end   = count - 1;
+		}
+		else
+		{
+			start = middle(outline[last], outline[first]);
+		}
+
+		const size_t contourStart = points.size();
+		points.push_back(place(start.x, start.y));
+
+		Point current    = start;
+		Point control    = start;
+		bool  hasControl = false;
+		for (u32 i = next; i <= end; i++)
+		{
+			// The walk ends back at the start to close the contour
+			const bool   closing = i == end;
+			const u32    index   = first + (i % count);
+			const Point& point   = closing ? start : outline[index];
+			const bool   curve   = closing || (flags[index] & onCurve);
+
+			if (curve)
+			{
+				if (hasControl)
+					addCurve(current, control, point);
+				else
+					points.push_back(place(point.x, point.y));
+				current    = point;
+				hasControl = false;
+			}
+			else
+			{
+				if (hasControl)
+				{
+					const Point between = middle(control, point);
+					addCurve(current, control, between);
+					current = between;
+				}
+				control    = point;
+				hasControl = true;
+			}
+		}
+
+		// The closing point repeats the start, and the rasterizer closes contours itself
+		points.pop_back();
+		if (points.size() > contourStart)
+			contourEnds.push_back(static_cast<u32>(points.size()));
+		first = last + 1;
+	}
+}
+
+u8 Font::ReadU8(const size_t offset) const
+{
+	if (offset >= this->_data.size())
+		throw std::out_of_range("Font data is truncated.");
+
+	return this->_data[offset];
+}
+
+u16 Font::ReadU16(const size_t offset) const
+{
+	if (offset + 2 > this->_data.size())
+		throw std::out_of_range("Font data is truncated.");
+
+	return static_cast<u16>(this->_data[offset] << 8 | this->_data[offset + 1]);
+}
+
+i16 Font::ReadI16(const size_t offset) const
+{
+	return static_cast<i16>(this->ReadU16(offset));
+}
+
+u32 Font::ReadU32(const size_t offset) const
+{
+	if (offset + 4 > this->_data.size())
+		throw std::out_of_range("Font data is truncated.");
+
+	return static_cast<u32>(this->_data[offset]) << 24 | static_cast<u32>(this->_data[offset + 1]) << 16
+	     | static_cast<u32>(this->_data[offset + 2]) << 8 | this->_data[offset + 3];
+}
+
+}
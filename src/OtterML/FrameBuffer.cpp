@@ -0,0 +1,250 @@
+#include <OtterML/FrameBuffer.hpp>
+
+#include <stdexcept>
+#include <string>
+
+#include <glad/gl.h>
+#include <OtterML/GLState.hpp>
+
+namespace oter
+{
+
+static GLenum RenderbufferFormat(const TextureFormat format)
+{
+	switch (format)
+	{
+	case TextureFormat::RGBA8:
+		return GL_RGBA8;
+	case TextureFormat::RGBA16F:
+		return GL_RGBA16F;
+	case TextureFormat::Depth24Stencil8:
+		return GL_DEPTH24_STENCIL8;
+	case TextureFormat::Depth32F:
+		return GL_DEPTH_COMPONENT32F;
+	}
+	return GL_RGBA8;
+}
+
+static GLenum DepthAttachment(const TextureFormat format)
+{
+	return format == TextureFormat::Depth24Stencil8 ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT;
+}
+
+bool operator==(const FrameBufferFormat& left, const FrameBufferFormat& right)
+{
+	return left.Size == right.Size
+	    && left.ColorFormat == right.ColorFormat
+	    && left.HasDepth == right.HasDepth
+	    && (!left.HasDepth || left.DepthFormat == right.DepthFormat)
+	    && left.Samples == right.Samples;
+}
+
+FrameBuffer::FrameBuffer() {}
+
+FrameBuffer::~FrameBuffer() {}
+
+void FrameBuffer::Init(const FrameBufferFormat& format)
+{
+	this->_format = format;
+
+	const GLsizei width  = static_cast<GLsizei>(format.Size.X);
+	const GLsizei height = static_cast<GLsizei>(format.Size.Y);
+	const GLenum  depth  = DepthAttachment(format.DepthFormat);
+
+	glGenFramebuffers(1, &this->_id);
+	GLState::BindFrameBuffer(GL_FRAMEBUFFER, this->_id);
+
+	this->_color.Generate(format.Size, format.ColorFormat);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, this->_color.GetID(), 0);
+	if (format.HasDepth)
+	{
+		this->_depth.Generate(format.Size, format.DepthFormat);
+		glFramebufferTexture2D(GL_FRAMEBUFFER, depth, GL_TEXTURE_2D, this->_depth.GetID(), 0);
+	}
+	CheckStatus();
+
+	if (format.Samples > 1)
+	{
+		const GLsizei samples = static_cast<GLsizei>(format.Samples);
+
+		glGenFramebuffers(1, &this->_multisampleID);
+		GLState::BindFrameBuffer(GL_FRAMEBUFFER, this->_multisampleID);
+
+		glGenRenderbuffers(1, &this->_multisampleColor);
+		glBindRenderbuffer(GL_RENDERBUFFER, this->_multisampleColor);
+		glRenderbufferStorageMultisample(GL_RENDERBUFFER, samples, RenderbufferFormat(format.ColorFormat), width, height);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, this->_multisampleColor);
+
+		if (format.HasDepth)
+		{
+			glGenRenderbuffers(1, &this->_multisampleDepth);
+			glBindRenderbuffer(GL_RENDERBUFFER, this->_multisampleDepth);
+			glRenderbufferStorageMultisample(GL_RENDERBUFFER, samples, RenderbufferFormat(format.DepthFormat), width, height);
+			glFramebufferRenderbuffer(GL_FRAMEBUFFER, depth, GL_RENDERBUFFER, this->_multisampleDepth);
+		}
+
+		glBindRenderbuffer(GL_RENDERBUFFER, 0);
+		CheckStatus();
+	}
+
+	GLState::BindFrameBuffer(GL_FRAMEBUFFER, 0);
+	this->_needsResolve = false;
+}
+
+void FrameBuffer::Delete()
+{
+	const u32 frameBuffers[2]  = { this->_id, this->_multisampleID };
+	const u32 renderBuffers[2] = { this->_multisampleColor, this->_multisampleDepth };
+	GLState::DeleteFrameBuffers(2, frameBuffers);
+	glDeleteRenderbuffers(2, renderBuffers);
+
+	this->_color.Delete();
+	this->_depth.Delete();
+
+	this->_id               = 0;
+	this->_multisampleID    = 0;
+	this->_multisampleColor = 0;
+	this->_multisampleDepth = 0;
+	this->_needsResolve     = false;
+}
+
+void FrameBuffer::Bind()
+{
+	const bool multisampled = this->_multisampleID != 0;
+
+	GLState::BindFrameBuffer(GL_FRAMEBUFFER, multisampled ? this->_multisampleID : this->_id);
+	glViewport(0, 0, static_cast<GLsizei>(this->_format.Size.X), static_cast<GLsizei>(this->_format.Size.Y));
+
+	// Binding is the only way to draw into it, so assume it is about to change
+	this->_needsResolve = multisampled;
+}
+
+void FrameBuffer::BindDefault(const Vector2<u32>& size)
+{
+	GLState::BindFrameBuffer(GL_FRAMEBUFFER, 0);
+	glViewport(0, 0, static_cast<GLsizei>(size.X), static_cast<GLsizei>(size.Y));
+}
+
+void FrameBuffer::Resolve()
+{
+	if (!this->_needsResolve)
+		return;
+
+	const GLint width  = static_cast<GLint>(this->_format.Size.X);
+	const GLint height = static_cast<GLint>(this->_format.Size.Y);
+
+	GLbitfield mask = GL_COLOR_BUFFER_BIT;
+	if (this->_format.HasDepth)
+		mask |= GL_DEPTH_BUFFER_BIT;
+
+	// Resolving usually happens right before drawing somewhere else, such as a present pass into the caller's target,
+	// so the bindings are put back rather than leaving the resolve framebuffer as the draw target
+	const u32 previousDraw = GLState::GetFrameBuffer(GL_DRAW_FRAMEBUFFER);
+	const u32 previousRead = GLState::GetFrameBuffer(GL_READ_FRAMEBUFFER);
+
+	GLState::BindFrameBuffer(GL_READ_FRAMEBUFFER, this->_multisampleID);
+	GLState::BindFrameBuffer(GL_DRAW_FRAMEBUFFER, this->_id);
+	glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, mask, GL_NEAREST);
+
+	GLState::BindFrameBuffer(GL_READ_FRAMEBUFFER, previousRead);
+	GLState::BindFrameBuffer(GL_DRAW_FRAMEBUFFER, previousDraw);
+
+	this->_needsResolve = false;
+}
+
+const Texture2D& FrameBuffer::GetColorTexture() const
+{
+	return this->_color;
+}
+
+const Texture2D& FrameBuffer::GetDepthTexture() const
+{
+	if (!this->_format.HasDepth)
+		throw std::out_of_range("FrameBuffer has no depth attachment.");
+
+	return this->_depth;
+}
+
+const FrameBufferFormat& FrameBuffer::GetFormat() const
+{
+	return this->_format;
+}
+
+const Vector2<u32>& FrameBuffer::GetSize() const
+{
+	return this->_format.Size;
+}
+
+u32 FrameBuffer::GetID() const
+{
+	return this->_id;
+}
+
+void FrameBuffer::CheckStatus()
+{
+	const GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+	if (status != GL_FRAMEBUFFER_COMPLETE)
+		throw std::runtime_error("FrameBuffer is incomplete, status " + std::to_string(status) + ".");
+}
+
+FrameBufferPool::FrameBufferPool() {}
+
+FrameBufferPool::~FrameBufferPool() {}
+
+FrameBuffer& FrameBufferPool::Acquire(const FrameBufferFormat& format)
+{
+	for (Entry& entry : this->_entries)
+	{
+		if (!entry.inUse && entry.frameBuffer->GetFormat() == format)
+		{
+			entry.inUse = true;
+			return *entry.frameBuffer;
+		}
+	}
+
+	Entry entry = { std::make_unique<FrameBuffer>(), true };
+	entry.frameBuffer->Init(format);
+	this->_entries.push_back(std::move(entry));
+	return *this->_entries.back().frameBuffer;
+}
+
+void FrameBufferPool::Release(const FrameBuffer& frameBuffer)
+{
+	for (Entry& entry : this->_entries)
+	{
+		if (entry.frameBuffer.get() == &frameBuffer)
+		{
+			entry.inUse = false;
+			return;
+		}
+	}
+
+	throw std::invalid_argument("FrameBuffer does not belong to this FrameBufferPool.");
+}
+
+void FrameBufferPool::Clear()
+{
+	for (Entry& entry : this->_entries)
+	{
+		entry.frameBuffer->Delete();
+	}
+	this->_entries.clear();
+}
+
+u32 FrameBufferPool::GetCount() const
+{
+	return static_cast<u32>(this->_entries.size());
+}
+
+u32 FrameBufferPool::GetFreeCount() const
+{
+	u32 count = 0;
+	for (const Entry& entry : this->_entries)
+	{
+		if (!entry.inUse)
+			count++;
+	}
+	return count;
+}
+
+}
@@ -0,0 +1,70 @@
+#include <OtterML/FullscreenPass.hpp>
+
+#include <glad/gl.h>
+#include <OtterML/GLState.hpp>
+#include <OtterML/RenderStats.hpp>
+#include <OtterML/Shader.hpp>
+#include <OtterML/Texture2D.hpp>
+
+namespace oter
+{
+
+const char* const FullscreenPass::VERTEX_SOURCE = R"(#version 330 core
+out vec2 vTexCoord;
+
+void main()
+{
+	// Corners (-1, -1), (3, -1) and (-1, 3): one triangle whose inner part is exactly the viewport
+	vec2 corner = vec2(float((gl_VertexID & 1) << 2), float((gl_VertexID & 2) << 1)) - 1.0;
+
+	gl_Position = vec4(corner, 0.0, 1.0);
+	vTexCoord   = corner * 0.5 + 0.5;
+}
+)";
+
+const char* const FullscreenPass::FRAGMENT_SOURCE = R"(#version 330 core
+in vec2 vTexCoord;
+
+uniform sampler2D uSource;
+
+out vec4 FragColor;
+
+void main()
+{
+	FragColor = texture(uSource, vTexCoord);
+}
+)";
+
+FullscreenPass::FullscreenPass() {}
+
+FullscreenPass::~FullscreenPass() {}
+
+void FullscreenPass::Init()
+{
+	glGenVertexArrays(1, &this->_vao);
+}
+
+void FullscreenPass::Delete()
+{
+	GLState::DeleteVertexArrays(1, &this->_vao);
+	this->_vao = 0;
+}
+
+void FullscreenPass::Draw(const Shader& shader) const
+{
+	shader.Use();
+	GLState::BindVertexArray(this->_vao);
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+	RenderStats::AddDraw(GL_TRIANGLES, 3);
+}
+
+void FullscreenPass::Draw(const Texture2D& source, const Shader& shader) const
+{
+	GLState::ActiveTexture(0);
+	source.Bind();
+	shader.SetInt("uSource", 0, true);
+
+	this->Draw(shader);
+}
+
+}
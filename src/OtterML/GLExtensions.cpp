@@ -0,0 +1,55 @@
+#include <OtterML/GLExtensions.hpp>
+
+#include <cstring>
+
+namespace oter
+{
+
+GLExtensionFunctions GLExtensions;
+
+static bool HasVersion(const i32 major, const i32 minor)
+{
+	i32 contextMajor = 0;
+	i32 contextMinor = 0;
+	glGetIntegerv(GL_MAJOR_VERSION, &contextMajor);
+	glGetIntegerv(GL_MINOR_VERSION, &contextMinor);
+	return contextMajor > major || (contextMajor == major && contextMinor >= minor);
+}
+
+static bool HasExtension(const char* name)
+{
+	i32 count = 0;
+	glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+	for (i32 i = 0; i < count; i++)
+	{
+		const char* extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, static_cast<u32>(i)));
+		if (extension != nullptr && strcmp(extension, name) == 0)
+			return true;
+	}
+	return false;
+}
+
+void LoadGLExtensions(const GLADloadfunc load)
+{
+	GLExtensions = GLExtensionFunctions();
+
+	if (HasVersion(4, 4) || HasExtension("GL_ARB_buffer_storage"))
+		GLExtensions.BufferStorage = reinterpret_cast<GLExtensionFunctions::BufferStorageFunc>(load("glBufferStorage"));
+
+	if (HasVersion(4, 3) || HasExtension("GL_ARB_multi_draw_indirect"))
+	{
+		GLExtensions.MultiDrawElementsIndirect =
+			reinterpret_cast<GLExtensionFunctions::MultiDrawElementsIndirectFunc>(load("glMultiDrawElementsIndirect"));
+	}
+}
+
+bool LoadGL(const GLADloadfunc load)
+{
+	if (gladLoadGL(load) == 0)
+		return false;
+
+	LoadGLExtensions(load);
+	return true;
+}
+
+}
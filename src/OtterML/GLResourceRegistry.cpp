@@ -0,0 +1,183 @@
+#include <OtterML/GLResourceRegistry.hpp>
+
+#include <glad/gl.h>
+#include <OtterML/GLState.hpp>
+
+namespace oter
+{
+
+u32 GLResourceRegistry::SlotTable::Add(const u32 name)
+{
+	this->liveCount++;
+
+	if (!this->freeSlots.empty())
+	{
+		const u32 index = this->freeSlots.back();
+		this->freeSlots.pop_back();
+		this->names[index] = name;
+		return index;
+	}
+
+	this->names.push_back(name);
+	this->generations.push_back(0);
+	return static_cast<u32>(this->names.size() - 1);
+}
+
+bool GLResourceRegistry::SlotTable::IsValid(const u32 index, const u32 generation) const
+{
+	return index < this->names.size() && this->generations[index] == generation && this->names[index] != 0;
+}
+
+void GLResourceRegistry::SlotTable::Remove(const u32 index, const u32 generation)
+{
+	if (!this->IsValid(index, generation))
+		return;
+
+	// The slot can be handed out again right away; the bumped generation keeps old handles from resolving to it
+	this->pendingDeletion.push_back(this->names[index]);
+	this->names[index] = 0;
+	this->generations[index]++;
+	this->freeSlots.push_back(index);
+	this->liveCount--;
+}
+
+void GLResourceRegistry::SlotTable::RemoveAll()
+{
+	for (u32 i = 0; i < this->names.size(); i++)
+	{
+		this->Remove(i, this->generations[i]);
+	}
+}
+
+GLResourceRegistry::GLResourceRegistry() {}
+
+GLResourceRegistry::~GLResourceRegistry() {}
+
+BufferHandle GLResourceRegistry::CreateBuffer()
+{
+	u32 name = 0;
+	glGenBuffers(1, &name);
+	return this->RegisterBuffer(name);
+}
+
+TextureHandle GLResourceRegistry::CreateTexture()
+{
+	u32 name = 0;
+	glGenTextures(1, &name);
+	return this->RegisterTexture(name);
+}
+
+BufferHandle GLResourceRegistry::RegisterBuffer(const u32 name)
+{
+	const u32 index = this->_buffers.Add(name);
+	return { index, this->_buffers.generations[index] };
+}
+
+TextureHandle GLResourceRegistry::RegisterTexture(const u32 name)
+{
+	const u32 index = this->_textures.Add(name);
+	return { index, this->_textures.generations[index] };
+}
+
+ProgramHandle GLResourceRegistry::RegisterProgram(const u32 name)
+{
+	const u32 index = this->_programs.Add(name);
+	return { index, this->_programs.generations[index] };
+}
+
+void GLResourceRegistry::Destroy(const BufferHandle handle)
+{
+	this->_buffers.Remove(handle.Index, handle.Generation);
+}
+
+void GLResourceRegistry::Destroy(const TextureHandle handle)
+{
+	this->_textures.Remove(handle.Index, handle.Generation);
+}
+
+void GLResourceRegistry::Destroy(const ProgramHandle handle)
+{
+	this->_programs.Remove(handle.Index, handle.Generation);
+}
+
+bool GLResourceRegistry::IsValid(const BufferHandle handle) const
+{
+	return this->_buffers.IsValid(handle.Index, handle.Generation);
+}
+
+bool GLResourceRegistry::IsValid(const TextureHandle handle) const
+{
+	return this->_textures.IsValid(handle.Index, handle.Generation);
+}
+
+bool GLResourceRegistry::IsValid(const ProgramHandle handle) const
+{
+	return this->_programs.IsValid(handle.Index, handle.Generation);
+}
+
+u32 GLResourceRegistry::Get(const BufferHandle handle) const
+{
+	return this->IsValid(handle) ? this->_buffers.names[handle.Index] : 0;
+}
+
+u32 GLResourceRegistry::Get(const TextureHandle handle) const
+{
+	return this->IsValid(handle) ? this->_textures.names[handle.Index] : 0;
+}
+
+u32 GLResourceRegistry::Get(const ProgramHandle handle) const
+{
+	return this->IsValid(handle) ? this->_programs.names[handle.Index] : 0;
+}
+
+void GLResourceRegistry::FlushDeletions()
+{
+	if (!this->_buffers.pendingDeletion.empty())
+	{
+		GLState::DeleteBuffers(static_cast<u32>(this->_buffers.pendingDeletion.size()), this->_buffers.pendingDeletion.data());
+		this->_buffers.pendingDeletion.clear();
+	}
+
+	if (!this->_textures.pendingDeletion.empty())
+	{
+		GLState::DeleteTextures(static_cast<u32>(this->_textures.pendingDeletion.size()), this->_textures.pendingDeletion.data());
+		this->_textures.pendingDeletion.clear();
+	}
+
+	// GL has no batched program deletion
+	for (const u32 program : this->_programs.pendingDeletion)
+	{
+		GLState::DeleteProgram(program);
+	}
+	this->_programs.pendingDeletion.clear();
+}
+
+void GLResourceRegistry::Clear()
+{
+	this->_buffers.RemoveAll();
+	this->_textures.RemoveAll();
+	this->_programs.RemoveAll();
+	this->FlushDeletions();
+}
+
+u32 GLResourceRegistry::GetLiveCount(const GLResourceType type) const
+{
+	switch (type)
+	{
+	case GLResourceType::Buffer:
+		return this->_buffers.liveCount;
+	case GLResourceType::Texture:
+		return this->_textures.liveCount;
+	case GLResourceType::Program:
+		return this->_programs.liveCount;
+	}
+	return 0;
+}
+
+u32 GLResourceRegistry::GetPendingDeletionCount() const
+{
+	return static_cast<u32>(this->_buffers.pendingDeletion.size() + this->_textures.pendingDeletion.size()
+	                        + this->_programs.pendingDeletion.size());
+}
+
+}
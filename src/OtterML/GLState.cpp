@@ -0,0 +1,320 @@
+#include <OtterML/GLState.hpp>
+
+#include <glad/gl.h>
+#include <OtterML/RenderStats.hpp>
+
+namespace oter
+{
+
+namespace
+{
+constexpr u32 UNKNOWN       = UINT32_MAX;
+constexpr u32 TEXTURE_UNITS = 32;
+
+constexpr u32 TEXTURE_TARGETS[] = {
+	GL_TEXTURE_2D,
+	GL_TEXTURE_2D_ARRAY,
+	GL_TEXTURE_2D_MULTISAMPLE,
+	GL_TEXTURE_3D,
+	GL_TEXTURE_CUBE_MAP,
+	GL_TEXTURE_RECTANGLE,
+	GL_TEXTURE_BUFFER,
+};
+
+constexpr u32 BUFFER_TARGETS[] = {
+	GL_ARRAY_BUFFER,
+	GL_ELEMENT_ARRAY_BUFFER,
+	GL_UNIFORM_BUFFER,
+	GL_COPY_READ_BUFFER,
+	GL_COPY_WRITE_BUFFER,
+	GL_PIXEL_PACK_BUFFER,
+	GL_PIXEL_UNPACK_BUFFER,
+	GL_DRAW_INDIRECT_BUFFER,
+	GL_TEXTURE_BUFFER,
+};
+
+constexpr u32 TEXTURE_TARGET_COUNT = sizeof(TEXTURE_TARGETS) / sizeof(TEXTURE_TARGETS[0]);
+constexpr u32 BUFFER_TARGET_COUNT  = sizeof(BUFFER_TARGETS) / sizeof(BUFFER_TARGETS[0]);
+constexpr u32 ELEMENT_BUFFER_SLOT  = 1;
+
+struct ShadowState
+{
+public:
+	u32 program     = UNKNOWN;
+	u32 activeUnit  = UNKNOWN;
+	u32 vertexArray = UNKNOWN;
+	u32 drawFrame   = UNKNOWN;
+	u32 readFrame   = UNKNOWN;
+	u32 textures[TEXTURE_UNITS][TEXTURE_TARGET_COUNT];
+	u32 buffers[BUFFER_TARGET_COUNT];
+
+	GLStateCounters counters;
+
+	ShadowState()
+	{
+		this->Forget();
+	}
+
+	void Forget()
+	{
+		this->program     = UNKNOWN;
+		this->activeUnit  = UNKNOWN;
+		this->vertexArray = UNKNOWN;
+		this->drawFrame   = UNKNOWN;
+		this->readFrame   = UNKNOWN;
+		for (auto& unit : this->textures)
+		{
+			for (u32& texture : unit)
+			{
+				texture = UNKNOWN;
+			}
+		}
+		for (u32& buffer : this->buffers)
+		{
+			buffer = UNKNOWN;
+		}
+	}
+};
+
+thread_local ShadowState state;
+
+u32 TextureSlot(const u32 target)
+{
+	for (u32 i = 0; i < TEXTURE_TARGET_COUNT; i++)
+	{
+		if (TEXTURE_TARGETS[i] == target)
+			return i;
+	}
+	return UNKNOWN;
+}
+
+u32 BufferSlot(const u32 target)
+{
+	for (u32 i = 0; i < BUFFER_TARGET_COUNT; i++)
+	{
+		if (BUFFER_TARGETS[i] == target)
+			return i;
+	}
+	return UNKNOWN;
+}
+}
+
+u64 GLStateCounters::GetIssuedCount() const
+{
+	return this->ProgramBinds + this->TextureBinds + this->BufferBinds + this->VertexArrayBinds + this->FrameBufferBinds
+	     + this->ActiveTextureCalls;
+}
+
+u64 GLStateCounters::GetSkippedCount() const
+{
+	return this->ProgramSkips + this->TextureSkips + this->BufferSkips + this->VertexArraySkips + this->FrameBufferSkips
+	     + this->ActiveTextureSkips;
+}
+
+void GLState::UseProgram(const u32 program)
+{
+	if (state.program == program)
+	{
+		state.counters.ProgramSkips++;
+		return;
+	}
+
+	glUseProgram(program);
+	state.program = program;
+	state.counters.ProgramBinds++;
+	RenderStats::Add(RenderCounter::ProgramBinds);
+}
+
+void GLState::ActiveTexture(const u32 unit)
+{
+	if (state.activeUnit == unit)
+	{
+		state.counters.ActiveTextureSkips++;
+		return;
+	}
+
+	glActiveTexture(GL_TEXTURE0 + unit);
+	state.activeUnit = unit;
+	state.counters.ActiveTextureCalls++;
+}
+
+void GLState::BindTexture(const u32 target, const u32 texture)
+{
+	const u32 slot = TextureSlot(target);
+
+	// Without a known unit or target there is nothing to compare against
+	if (slot == UNKNOWN || state.activeUnit >= TEXTURE_UNITS)
+	{
+		glBindTexture(target, texture);
+		state.counters.TextureBinds++;
+		RenderStats::Add(RenderCounter::TextureBinds);
+		return;
+	}
+
+	u32& bound = state.textures[state.activeUnit][slot];
+	if (bound == texture)
+	{
+		state.counters.TextureSkips++;
+		return;
+	}
+
+	glBindTexture(target, texture);
+	bound = texture;
+	state.counters.TextureBinds++;
+	RenderStats::Add(RenderCounter::TextureBinds);
+}
+
+void GLState::BindBuffer(const u32 target, const u32 buffer)
+{
+	const u32 slot = BufferSlot(target);
+	if (slot == UNKNOWN)
+	{
+		glBindBuffer(target, buffer);
+		state.counters.BufferBinds++;
+		RenderStats::Add(RenderCounter::BufferBinds);
+		return;
+	}
+
+	u32& bound = state.buffers[slot];
+	if (bound == buffer)
+	{
+		state.counters.BufferSkips++;
+		return;
+	}
+
+	glBindBuffer(target, buffer);
+	bound = buffer;
+	state.counters.BufferBinds++;
+	RenderStats::Add(RenderCounter::BufferBinds);
+}
+
+void GLState::BindVertexArray(const u32 vertexArray)
+{
+	if (state.vertexArray == vertexArray)
+	{
+		state.counters.VertexArraySkips++;
+		return;
+	}
+
+	glBindVertexArray(vertexArray);
+	state.vertexArray                  = vertexArray;
+	state.buffers[ELEMENT_BUFFER_SLOT] = UNKNOWN;
+	state.counters.VertexArrayBinds++;
+}
+
+void GLState::BindFrameBuffer(const u32 target, const u32 frameBuffer)
+{
+	const bool draw = target != GL_READ_FRAMEBUFFER;
+	const bool read = target != GL_DRAW_FRAMEBUFFER;
+
+	if ((!draw || state.drawFrame == frameBuffer) && (!read || state.readFrame == frameBuffer))
+	{
+		state.counters.FrameBufferSkips++;
+		return;
+	}
+
+	glBindFramebuffer(target, frameBuffer);
+	if (draw)
+		state.drawFrame = frameBuffer;
+	if (read)
+		state.readFrame = frameBuffer;
+	state.counters.FrameBufferBinds++;
+}
+
+u32 GLState::GetFrameBuffer(const u32 target)
+{
+	u32& frameBuffer = target == GL_READ_FRAMEBUFFER ? state.readFrame : state.drawFrame;
+	if (frameBuffer == UNKNOWN)
+	{
+		GLint bound = 0;
+		glGetIntegerv(target == GL_READ_FRAMEBUFFER ? GL_READ_FRAMEBUFFER_BINDING : GL_DRAW_FRAMEBUFFER_BINDING, &bound);
+		frameBuffer = static_cast<u32>(bound);
+	}
+	return frameBuffer;
+}
+
+void GLState::DeleteProgram(const u32 program)
+{
+	glDeleteProgram(program);
+
+	// A program in use is only flagged for deletion, so whether it is still current is up to the driver
+	if (state.program == program)
+		state.program = UNKNOWN;
+}
+
+void GLState::DeleteTextures(const u32 count, const u32* textures)
+{
+	glDeleteTextures(static_cast<i32>(count), textures);
+
+	// Deleting a bound texture reverts every unit it was bound to back to 0
+	for (u32 i = 0; i < count; i++)
+	{
+		for (auto& unit : state.textures)
+		{
+			for (u32& texture : unit)
+			{
+				if (texture == textures[i])
+					texture = 0;
+			}
+		}
+	}
+}
+
+void GLState::DeleteBuffers(const u32 count, const u32* buffers)
+{
+	glDeleteBuffers(static_cast<i32>(count), buffers);
+
+	for (u32 i = 0; i < count; i++)
+	{
+		for (u32& buffer : state.buffers)
+		{
+			if (buffer == buffers[i])
+				buffer = 0;
+		}
+	}
+}
+
+void GLState::DeleteVertexArrays(const u32 count, const u32* vertexArrays)
+{
+	glDeleteVertexArrays(static_cast<i32>(count), vertexArrays);
+
+	for (u32 i = 0; i < count; i++)
+	{
+		if (state.vertexArray == vertexArrays[i])
+		{
+			state.vertexArray                  = 0;
+			state.buffers[ELEMENT_BUFFER_SLOT] = UNKNOWN;
+		}
+	}
+}
+
+void GLState::DeleteFrameBuffers(const u32 count, const u32* frameBuffers)
+{
+	glDeleteFramebuffers(static_cast<i32>(count), frameBuffers);
+
+	// Deleting a bound framebuffer reverts the binding to the default framebuffer
+	for (u32 i = 0; i < count; i++)
+	{
+		if (state.drawFrame == frameBuffers[i])
+			state.drawFrame = 0;
+		if (state.readFrame == frameBuffers[i])
+			state.readFrame = 0;
+	}
+}
+
+void GLState::Invalidate()
+{
+	state.Forget();
+}
+
+const GLStateCounters& GLState::GetCounters()
+{
+	return state.counters;
+}
+
+void GLState::ResetCounters()
+{
+	state.counters = GLStateCounters();
+}
+
+}
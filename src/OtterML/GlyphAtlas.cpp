@@ -0,0 +1,151 @@
+#include <OtterML/GlyphAtlas.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <string>
+
+#include <OtterML/Font.hpp>
+#include <OtterML/Profiler.hpp>
+
+namespace oter
+{
+
+// Empty texels around every glyph, so linear filtering never reaches into a neighbour
+static constexpr u32 GLYPH_PADDING = 1;
+
+GlyphAtlas::GlyphAtlas() {}
+
+GlyphAtlas::~GlyphAtlas() {}
+
+void GlyphAtlas::Init(const Vector2<u32>& size)
+{
+	this->_size = size;
+
+	// Start transparent, so padding and unused space never show old contents
+	const std::vector<u8> clear(static_cast<size_t>(size.X) * size.Y * 4, 0);
+	this->_texture.Generate(size, clear.data());
+
+	this->Clear();
+}
+
+void GlyphAtlas::Delete()
+{
+	this->_texture.Delete();
+	this->_glyphs.clear();
+	this->_size = Vector2<u32>(0u);
+	this->_full = false;
+
+	// Runs laid out against the deleted texture must not keep using their placements
+	this->_generation++;
+}
+
+const AtlasGlyph& GlyphAtlas::GetGlyph(const Font& font, const u32 glyph, const u32 pixelHeight)
+{
+	const Key key = { &font, glyph, pixelHeight };
+
+	const auto found = this->_glyphs.find(key);
+	if (found != this->_glyphs.end())
+		return found->second;
+
+	OTTERML_PROFILE_ZONE("GlyphAtlas::GetGlyph");
+
+	const GlyphBitmap bitmap = font.Rasterize(glyph, static_cast<f32>(pixelHeight));
+
+	AtlasGlyph placed;
+	placed.Offset = Vector2<f32>(bitmap.Offset);
+	placed.Size   = Vector2<f32>(bitmap.Size);
+
+	// Blank glyphs such as space still get an entry, so they are not rasterized again
+	if (bitmap.Size.X > 0 && bitmap.Size.Y > 0)
+	{
+		if (bitmap.Size.X + 2 * GLYPH_PADDING > this->_size.X || bitmap.Size.Y + 2 * GLYPH_PADDING > this->_size.Y)
+			throw std::length_error("GlyphAtlas is too small for a glyph of " + std::to_string(pixelHeight) + " pixels.");
+
+		// Emptying the atlas now would overwrite texels that queued quads still sample, so wait for EndFrame()
+		Vector2<u32> position;
+		if (this->_full || !this->Pack(bitmap.Size, position))
+		{
+			this->_full = true;
+			return this->_missing;
+		}
+
+		this->_pixels.resize(bitmap.Coverage.size() * 4);
+		for (size_t i = 0; i < bitmap.Coverage.size(); i++)
+		{
+			this->_pixels[i * 4 + 0] = 0xFF;
+			this->_pixels[i * 4 + 1] = 0xFF;
+			this->_pixels[i * 4 + 2] = 0xFF;
+			this->_pixels[i * 4 + 3] = bitmap.Coverage[i];
+		}
+		this->_texture.Update(position, bitmap.Size, this->_pixels.data());
+
+		const Vector2<f32> atlasSize = Vector2<f32>(this->_size);
+		placed.UVPosition            = Vector2<f32>(position) / atlasSize;
+		placed.UVSize                = Vector2<f32>(bitmap.Size) / atlasSize;
+	}
+
+	return this->_glyphs.emplace(key, placed).first->second;
+}
+
+void GlyphAtlas::EndFrame()
+{
+	if (this->_full)
+		this->Clear();
+}
+
+void GlyphAtlas::Clear()
+{
+	this->_glyphs.clear();
+	this->_full        = false;
+	this->_shelfX      = GLYPH_PADDING;
+	this->_shelfY      = GLYPH_PADDING;
+	this->_shelfHeight = 0;
+	this->_generation++;
+}
+
+const Texture2D& GlyphAtlas::GetTexture() const
+{
+	return this->_texture;
+}
+
+u32 GlyphAtlas::GetGeneration() const
+{
+	return this->_generation;
+}
+
+u32 GlyphAtlas::GetGlyphCount() const
+{
+	return static_cast<u32>(this->_glyphs.size());
+}
+
+bool GlyphAtlas::IsFull() const
+{
+	return this->_full;
+}
+
+size_t GlyphAtlas::KeyHash::operator()(const Key& key) const
+{
+	const size_t font = std::hash<const Font*>()(key.font);
+	return font ^ (static_cast<size_t>(key.glyph) << 16 ^ key.pixelHeight) * 0x9E3779B97F4A7C15ull;
+}
+
+bool GlyphAtlas::Pack(const Vector2<u32>& size, Vector2<u32>& position)
+{
+	if (this->_shelfX + size.X + GLYPH_PADDING > this->_size.X)
+	{
+		this->_shelfX       = GLYPH_PADDING;
+		this->_shelfY      += this->_shelfHeight + GLYPH_PADDING;
+		this->_shelfHeight  = 0;
+	}
+
+	if (this->_shelfX + size.X + GLYPH_PADDING > this->_size.X || this->_shelfY + size.Y + GLYPH_PADDING > this->_size.Y)
+		return false;
+
+	position            = Vector2<u32>(this->_shelfX, this->_shelfY);
+	this->_shelfX      += size.X + GLYPH_PADDING;
+	this->_shelfHeight  = std::max(this->_shelfHeight, size.Y);
+	return true;
+}
+
+}
@@ -0,0 +1,188 @@
+#include <OtterML/GpuProfiler.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <glad/gl.h>
+
+namespace oter
+{
+
+GpuProfiler::Scope::Scope(GpuProfiler& profiler, const std::string& name)
+	: _profiler(profiler)
+{
+	this->_profiler.BeginRegion(name);
+}
+
+GpuProfiler::Scope::~Scope()
+{
+	this->_profiler.EndRegion();
+}
+
+GpuProfiler::GpuProfiler(const u32 historySize)
+	: _historySize(std::max(historySize, 1u)) {}
+
+GpuProfiler::~GpuProfiler() {}
+
+void GpuProfiler::Delete()
+{
+	for (Frame& frame : this->_frames)
+	{
+		for (const Query& query : frame.queries)
+		{
+			frame.freeNames.push_back(query.begin);
+			frame.freeNames.push_back(query.end);
+		}
+		frame.queries.clear();
+
+		glDeleteQueries(static_cast<GLsizei>(frame.freeNames.size()), frame.freeNames.data());
+		frame.freeNames.clear();
+	}
+	this->_openQueries.clear();
+}
+
+void GpuProfiler::BeginFrame()
+{
+	// These queries were issued FRAME_LATENCY frames ago, so they are read back just before being reused
+	this->ReadBack(this->_frames[this->_frameIndex]);
+}
+
+void GpuProfiler::EndFrame()
+{
+	if (!this->_openQueries.empty())
+		throw std::logic_error("GpuProfiler frame ended with a region still open.");
+
+	this->_frameIndex = (this->_frameIndex + 1) % FRAME_LATENCY;
+}
+
+void GpuProfiler::BeginRegion(const std::string& name)
+{
+	auto iter = this->_regionIndices.find(name);
+	if (iter == this->_regionIndices.end())
+	{
+		iter = this->_regionIndices.emplace(name, static_cast<u32>(this->_regions.size())).first;
+
+		Region region;
+		region.name = name;
+		region.history.reserve(this->_historySize);
+		this->_regions.push_back(std::move(region));
+	}
+
+	Frame& frame = this->_frames[this->_frameIndex];
+
+	Query query;
+	query.region = iter->second;
+	query.begin  = this->TakeQueryName(frame);
+	query.end    = this->TakeQueryName(frame);
+	glQueryCounter(query.begin, GL_TIMESTAMP);
+
+	this->_openQueries.push_back(static_cast<u32>(frame.queries.size()));
+	frame.queries.push_back(query);
+}
+
+void GpuProfiler::EndRegion()
+{
+	if (this->_openQueries.empty())
+		throw std::logic_error("GpuProfiler region ended without being started.");
+
+	const Frame& frame = this->_frames[this->_frameIndex];
+	glQueryCounter(frame.queries[this->_openQueries.back()].end, GL_TIMESTAMP);
+	this->_openQueries.pop_back();
+}
+
+f64 GpuProfiler::GetAverageMilliseconds(const std::string& name) const
+{
+	const auto iter = this->_regionIndices.find(name);
+	if (iter == this->_regionIndices.end())
+		return 0.0;
+
+	const Region& region = this->_regions[iter->second];
+	return region.history.empty() ? 0.0 : region.sum / static_cast<f64>(region.history.size());
+}
+
+std::vector<GpuTiming> GpuProfiler::GetTimings() const
+{
+	std::vector<GpuTiming> timings;
+	timings.reserve(this->_regions.size());
+
+	for (const Region& region : this->_regions)
+	{
+		GpuTiming timing;
+		timing.Name                = region.name;
+		timing.AverageMilliseconds = region.history.empty() ? 0.0 : region.sum / static_cast<f64>(region.history.size());
+		timing.LastMilliseconds    = region.last;
+		timing.SampleCount         = static_cast<u32>(region.history.size());
+		timings.push_back(timing);
+	}
+
+	return timings;
+}
+
+u32 GpuProfiler::TakeQueryName(Frame& frame)
+{
+	if (frame.freeNames.empty())
+	{
+		u32 name = 0;
+		glGenQueries(1, &name);
+		return name;
+	}
+
+	const u32 name = frame.freeNames.back();
+	frame.freeNames.pop_back();
+	return name;
+}
+
+void GpuProfiler::ReadBack(Frame& frame)
+{
+	this->_frameTotals.assign(this->_regions.size(), 0.0);
+	this->_frameTouched.assign(this->_regions.size(), false);
+
+	for (const Query& query : frame.queries)
+	{
+		// The end timestamp was issued last, so once it is available the begin one is too
+		GLint available = 0;
+		glGetQueryObjectiv(query.end, GL_QUERY_RESULT_AVAILABLE, &available);
+		if (available != 0)
+		{
+			GLuint64 begin = 0;
+			GLuint64 end   = 0;
+			glGetQueryObjectui64v(query.begin, GL_QUERY_RESULT, &begin);
+			glGetQueryObjectui64v(query.end, GL_QUERY_RESULT, &end);
+
+			this->_frameTotals[query.region] += static_cast<f64>(end - begin) / 1000000.0;
+			this->_frameTouched[query.region] = true;
+		}
+
+		frame.freeNames.push_back(query.begin);
+		frame.freeNames.push_back(query.end);
+	}
+	frame.queries.clear();
+
+	// A region recorded several times in one frame counts as one sample of their total
+	for (u32 i = 0; i < this->_regions.size(); i++)
+	{
+		if (this->_frameTouched[i])
+			this->AddSample(i, this->_frameTotals[i]);
+	}
+}
+
+void GpuProfiler::AddSample(const u32 region, const f64 milliseconds)
+{
+	Region& target = this->_regions[region];
+
+	if (target.history.size() < this->_historySize)
+	{
+		target.history.push_back(milliseconds);
+	}
+	else
+	{
+		target.sum -= target.history[target.next];
+		target.history[target.next] = milliseconds;
+	}
+
+	target.sum += milliseconds;
+	target.last = milliseconds;
+	target.next = (target.next + 1) % this->_historySize;
+}
+
+}
@@ -0,0 +1,193 @@
+#include <OtterML/HeadlessContext.hpp>
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <glad/gl.h>
+#include <OtterML/FrameBuffer.hpp>
+#include <OtterML/GLExtensions.hpp>
+#include <OtterML/GLState.hpp>
+
+namespace oter
+{
+
+static bool HasEGLExtension(const EGLDisplay display, const char* name)
+{
+	const char* extensions = eglQueryString(display, EGL_EXTENSIONS);
+	if (extensions == nullptr)
+		return false;
+
+	// Extension names are separated by spaces, so a match must end there to not be a prefix of a longer name
+	const size_t length = strlen(name);
+	for (const char* match = strstr(extensions, name); match != nullptr; match = strstr(match + length, name))
+	{
+		if ((match == extensions || match[-1] == ' ') && (match[length] == ' ' || match[length] == '\0'))
+			return true;
+	}
+	return false;
+}
+
+static EGLDisplay OpenSurfacelessDisplay()
+{
+	if (!HasEGLExtension(EGL_NO_DISPLAY, "EGL_MESA_platform_surfaceless"))
+		return EGL_NO_DISPLAY;
+
+	const auto getPlatformDisplay =
+		reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+	if (getPlatformDisplay == nullptr)
+		return EGL_NO_DISPLAY;
+
+	return getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+}
+
+HeadlessContext::HeadlessContext() {}
+
+HeadlessContext::~HeadlessContext()
+{
+	this->Delete();
+}
+
+void HeadlessContext::Create(const Vector2<u32>& size, const HeadlessContextSettings& settings)
+{
+	this->Delete();
+	this->_size = size;
+
+	EGLint     major   = 0;
+	EGLint     minor   = 0;
+	EGLDisplay display = OpenSurfacelessDisplay();
+	if (display == EGL_NO_DISPLAY || eglInitialize(display, &major, &minor) == EGL_FALSE)
+	{
+		display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+		if (display == EGL_NO_DISPLAY || eglInitialize(display, &major, &minor) == EGL_FALSE)
+			throw std::runtime_error("HeadlessContext could not initialize an EGL display.");
+	}
+
+	if (eglBindAPI(EGL_OPENGL_API) == EGL_FALSE)
+		throw std::runtime_error("HeadlessContext display does not support desktop OpenGL.");
+
+	const bool surfaceless = HasEGLExtension(display, "EGL_KHR_surfaceless_context");
+
+	const EGLint configAttributes[] = {
+		EGL_SURFACE_TYPE, surfaceless ? 0 : EGL_PBUFFER_BIT,
+		EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+		EGL_RED_SIZE, 8,
+		EGL_GREEN_SIZE, 8,
+		EGL_BLUE_SIZE, 8,
+		EGL_ALPHA_SIZE, 8,
+		EGL_DEPTH_SIZE, 24,
+		EGL_STENCIL_SIZE, 8,
+		EGL_NONE,
+	};
+
+	EGLConfig config      = nullptr;
+	EGLint    configCount = 0;
+	if (eglChooseConfig(display, configAttributes, &config, 1, &configCount) == EGL_FALSE || configCount == 0)
+		throw std::runtime_error("HeadlessContext found no matching EGL config.");
+
+	const EGLint contextAttributes[] = {
+		EGL_CONTEXT_MAJOR_VERSION, static_cast<EGLint>(settings.MajorVersion),
+		EGL_CONTEXT_MINOR_VERSION, static_cast<EGLint>(settings.MinorVersion),
+		EGL_CONTEXT_OPENGL_PROFILE_MASK, settings.CoreProfile ? EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT
+		                                                      : EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT,
+		EGL_CONTEXT_OPENGL_DEBUG, settings.Debug ? EGL_TRUE : EGL_FALSE,
+		EGL_NONE,
+	};
+
+	const EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttributes);
+	if (context == EGL_NO_CONTEXT)
+		throw std::runtime_error("HeadlessContext could not create a GL " + std::to_string(settings.MajorVersion) + "."
+		                         + std::to_string(settings.MinorVersion) + " context.");
+
+	EGLSurface surface = EGL_NO_SURFACE;
+	if (!surfaceless)
+	{
+		const EGLint surfaceAttributes[] = {
+			EGL_WIDTH, static_cast<EGLint>(size.X),
+			EGL_HEIGHT, static_cast<EGLint>(size.Y),
+			EGL_NONE,
+		};
+
+		surface = eglCreatePbufferSurface(display, config, surfaceAttributes);
+		if (surface == EGL_NO_SURFACE)
+		{
+			eglDestroyContext(display, context);
+			throw std::runtime_error("HeadlessContext could not create a pbuffer surface.");
+		}
+	}
+
+	this->_display = display;
+	this->_context = context;
+	this->_surface = surface;
+
+	this->MakeCurrent();
+	if (!LoadGL(reinterpret_cast<GLADloadfunc>(eglGetProcAddress)))
+	{
+		this->Delete();
+		throw std::runtime_error("HeadlessContext could not load GL.");
+	}
+}
+
+void HeadlessContext::Delete()
+{
+	if (this->_context == nullptr)
+		return;
+
+	// The display is left initialized, since other contexts in the process may share it
+	if (eglGetCurrentContext() == this->_context)
+	{
+		eglMakeCurrent(this->_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+		GLState::Invalidate();
+	}
+	if (this->_surface != nullptr)
+		eglDestroySurface(this->_display, this->_surface);
+	eglDestroyContext(this->_display, this->_context);
+
+	this->_display = nullptr;
+	this->_context = nullptr;
+	this->_surface = nullptr;
+}
+
+void HeadlessContext::MakeCurrent() const
+{
+	if (this->_context == nullptr)
+		throw std::logic_error("HeadlessContext made current before being created.");
+
+	if (eglMakeCurrent(this->_display, this->_surface, this->_surface, this->_context) == EGL_FALSE)
+		throw std::runtime_error("HeadlessContext could not be made current.");
+
+	GLState::Invalidate();
+}
+
+std::vector<u8> HeadlessContext::ReadPixels(FrameBuffer& frameBuffer) const
+{
+	frameBuffer.Resolve();
+
+	const Vector2<u32>& size = frameBuffer.GetSize();
+	std::vector<u8>     pixels(static_cast<size_t>(size.X) * size.Y * 4);
+
+	// A resolved framebuffer keeps its pixels in the color texture, which is the attachment of GetID()
+	GLState::BindFrameBuffer(GL_READ_FRAMEBUFFER, frameBuffer.GetID());
+	glReadPixels(0, 0, static_cast<i32>(size.X), static_cast<i32>(size.Y), GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+
+	return pixels;
+}
+
+bool HeadlessContext::IsCreated() const
+{
+	return this->_context != nullptr;
+}
+
+bool HeadlessContext::IsSurfaceless() const
+{
+	return this->_context != nullptr && this->_surface == nullptr;
+}
+
+const Vector2<u32>& HeadlessContext::GetSize() const
+{
+	return this->_size;
+}
+
+}
@@ -0,0 +1,173 @@
+#include <OtterML/InstancedSpriteBatch.hpp>
+
+#include <cstddef>
+
+#include <glad/gl.h>
+#include <OtterML/GLState.hpp>
+#include <OtterML/Profiler.hpp>
+#include <OtterML/RenderStats.hpp>
+#include <OtterML/Shader.hpp>
+#include <OtterML/Texture2D.hpp>
+
+namespace oter
+{
+
+const char* const InstancedSpriteBatch::VERTEX_SOURCE = R"(#version 330 core
+layout (location = 0) in vec3 aRow0;
+layout (location = 1) in vec3 aRow1;
+layout (location = 2) in vec4 aUVRect;
+layout (location = 3) in vec4 aColor;
+
+uniform mat3 uProjection;
+
+out vec2 vTexCoord;
+out vec4 vColor;
+
+void main()
+{
+	// Triangle strip over the unit quad: (0, 0), (1, 0), (0, 1), (1, 1)
+	vec3 corner   = vec3(float(gl_VertexID & 1), float(gl_VertexID >> 1), 1.0);
+	vec2 position = vec2(dot(aRow0, corner), dot(aRow1, corner));
+
+	gl_Position = vec4((uProjection * vec3(position, 1.0)).xy, 0.0, 1.0);
+	vTexCoord   = aUVRect.xy + corner.xy * aUVRect.zw;
+	vColor      = aColor;
+}
+)";
+
+const char* const InstancedSpriteBatch::FRAGMENT_SOURCE = R"(#version 330 core
+in vec2 vTexCoord;
+in vec4 vColor;
+
+uniform sampler2D uTexture;
+
+out vec4 FragColor;
+
+void main()
+{
+	FragColor = texture(uTexture, vTexCoord) * vColor;
+}
+)";
+
+InstancedSpriteBatch::InstancedSpriteBatch() {}
+
+InstancedSpriteBatch::~InstancedSpriteBatch() {}
+
+void InstancedSpriteBatch::Init()
+{
+	// A few thousand instances per region before the stream buffer has to move on or grow
+	constexpr u32 regionSize = 8192 * sizeof(SpriteInstance);
+
+	glGenVertexArrays(1, &this->_vao);
+	this->_instanceStream.Init(GL_ARRAY_BUFFER, regionSize);
+
+	GLState::BindVertexArray(this->_vao);
+	for (u32 i = 0; i < 4; i++)
+	{
+		glEnableVertexAttribArray(i);
+		glVertexAttribDivisor(i, 1);
+	}
+	GLState::BindVertexArray(0);
+}
+
+void InstancedSpriteBatch::Delete()
+{
+	this->_instanceStream.Delete();
+	GLState::DeleteVertexArrays(1, &this->_vao);
+
+	this->_vao = 0;
+}
+
+void InstancedSpriteBatch::Begin()
+{
+	this->_instances.clear();
+}
+
+void InstancedSpriteBatch::Draw(const SpriteInstance& instance)
+{
+	this->_instances.push_back(instance);
+}
+
+void InstancedSpriteBatch::Draw(const Matrix<f32, 3, 3>& transform, const Vector2<f32>& size,
+                                const Vector2<f32>& uvPosition, const Vector2<f32>& uvSize, const Color& color)
+{
+	this->_instances.push_back(MakeInstance(transform, size, uvPosition, uvSize, color));
+}
+
+void InstancedSpriteBatch::Draw(const std::span<const Matrix<f32, 3, 3>> transforms, const Vector2<f32>& size,
+                                const Vector2<f32>& uvPosition, const Vector2<f32>& uvSize, const Color& color)
+{
+	const size_t first = this->_instances.size();
+	this->_instances.resize(first + transforms.size());
+
+	for (size_t i = 0; i < transforms.size(); i++)
+	{
+		this->_instances[first + i] = MakeInstance(transforms[i], size, uvPosition, uvSize, color);
+	}
+}
+
+void InstancedSpriteBatch::End(const Texture2D& texture, const Shader& shader)
+{
+	OTTERML_PROFILE_ZONE("InstancedSpriteBatch::End");
+
+	this->_instanceCount = static_cast<u32>(this->_instances.size());
+
+	if (this->_instances.empty())
+		return;
+
+	const u32 offset = this->_instanceStream.Write(
+		this->_instances.data(),
+		static_cast<u32>(this->_instances.size() * sizeof(SpriteInstance)),
+		sizeof(SpriteInstance)
+	);
+
+	// glVertexAttribDivisor has no base instance before GL 4.2, so the attributes point straight at this frame's data
+	GLState::BindVertexArray(this->_vao);
+	GLState::BindBuffer(GL_ARRAY_BUFFER, this->_instanceStream.GetID());
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance),
+	                      reinterpret_cast<void*>(offset + offsetof(SpriteInstance, Row0)));
+	glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance),
+	                      reinterpret_cast<void*>(offset + offsetof(SpriteInstance, Row1)));
+	glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance),
+	                      reinterpret_cast<void*>(offset + offsetof(SpriteInstance, UVX)));
+	glVertexAttribPointer(3, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(SpriteInstance),
+	                      reinterpret_cast<void*>(offset + offsetof(SpriteInstance, Tint)));
+
+	shader.Use();
+	GLState::ActiveTexture(0);
+	texture.Bind();
+
+	glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<i32>(this->_instanceCount));
+	RenderStats::AddDraw(GL_TRIANGLE_STRIP, 4, this->_instanceCount);
+
+	GLState::BindVertexArray(0);
+}
+
+u32 InstancedSpriteBatch::GetInstanceCount() const
+{
+	return this->_instanceCount;
+}
+
+SpriteInstance InstancedSpriteBatch::MakeInstance(const Matrix<f32, 3, 3>& transform, const Vector2<f32>& size,
+                                                  const Vector2<f32>& uvPosition, const Vector2<f32>& uvSize,
+                                                  const Color& color)
+{
+	const std::array<f32, 9>& m = transform.GetData();
+
+	// Scaling the first two columns by the size lets the shader work on the unit quad
+	SpriteInstance instance;
+	instance.Row0[0] = m[0] * size.X;
+	instance.Row0[1] = m[1] * size.Y;
+	instance.Row0[2] = m[2];
+	instance.Row1[0] = m[3] * size.X;
+	instance.Row1[1] = m[4] * size.Y;
+	instance.Row1[2] = m[5];
+	instance.UVX     = uvPosition.X;
+	instance.UVY     = uvPosition.Y;
+	instance.UVW     = uvSize.X;
+	instance.UVH     = uvSize.Y;
+	instance.Tint    = color;
+	return instance;
+}
+
+}
@@ -0,0 +1,199 @@
+#include <OtterML/Profiler.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+
+namespace oter
+{
+
+namespace
+{
+
+struct EventRing
+{
+public:
+	ProfileEvent     events[Profiler::RING_CAPACITY];
+	std::atomic<u32> head        = 0; // Written by the owning thread only
+	std::atomic<u32> tail        = 0; // Written by Collect() only
+	std::atomic<u64> dropped     = 0;
+	u32              threadIndex = 0;
+};
+
+struct ProfilerState
+{
+public:
+	// Rings are shared so that zones a thread recorded before exiting can still be collected
+	std::mutex                              ringMutex;
+	std::vector<std::shared_ptr<EventRing>> rings;
+
+	std::mutex                collectMutex;
+	std::vector<ProfileEvent> events;
+
+	const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+};
+
+ProfilerState& GetState()
+{
+	static ProfilerState state;
+	return state;
+}
+
+EventRing& GetThreadRing()
+{
+	thread_local EventRing* ring = nullptr;
+
+	if (ring == nullptr)
+	{
+		ProfilerState& state = GetState();
+		const std::lock_guard<std::mutex> lock(state.ringMutex);
+
+		auto shared         = std::make_shared<EventRing>();
+		shared->threadIndex = static_cast<u32>(state.rings.size());
+		state.rings.push_back(shared);
+		ring = shared.get();
+	}
+
+	return *ring;
+}
+
+void WriteEscaped(std::ostream& stream, const char* text)
+{
+	for (; *text != '\0'; text++)
+	{
+		const char c = *text;
+		if (c == '"' || c == '\\')
+			stream << '\\' << c;
+		else if (static_cast<unsigned char>(c) < 0x20)
+			stream << ' ';
+		else
+			stream << c;
+	}
+}
+
+}
+
+void Profiler::Record(const char* name, const u64 start, const u64 end)
+{
+	EventRing& ring = GetThreadRing();
+
+	const u32 head = ring.head.load(std::memory_order_relaxed);
+	if (head - ring.tail.load(std::memory_order_acquire) >= RING_CAPACITY)
+	{
+		ring.dropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	ProfileEvent& event = ring.events[head % RING_CAPACITY];
+	event.Name          = name;
+	event.Start         = start;
+	event.End           = end;
+	event.ThreadIndex   = ring.threadIndex;
+
+	ring.head.store(head + 1, std::memory_order_release);
+}
+
+u64 Profiler::Now()
+{
+	const auto elapsed = std::chrono::steady_clock::now() - GetState().epoch;
+	return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+void Profiler::Collect()
+{
+	ProfilerState& state = GetState();
+
+	std::vector<std::shared_ptr<EventRing>> rings;
+	{
+		const std::lock_guard<std::mutex> lock(state.ringMutex);
+		rings = state.rings;
+	}
+
+	const std::lock_guard<std::mutex> lock(state.collectMutex);
+	for (const std::shared_ptr<EventRing>& ring : rings)
+	{
+		const u32 head = ring->head.load(std::memory_order_acquire);
+		u32       tail = ring->tail.load(std::memory_order_relaxed);
+
+		for (; tail != head; tail++)
+		{
+			state.events.push_back(ring->events[tail % RING_CAPACITY]);
+		}
+
+		ring->tail.store(tail, std::memory_order_release);
+	}
+}
+
+void Profiler::WriteChromeTrace(std::ostream& stream)
+{
+	ProfilerState& state = GetState();
+	const std::lock_guard<std::mutex> lock(state.collectMutex);
+
+	std::vector<ProfileEvent> events = state.events;
+	std::stable_sort(events.begin(), events.end(), [](const ProfileEvent& left, const ProfileEvent& right)
+	{
+		return left.Start < right.Start;
+	});
+
+	// Complete ("X") events take microseconds; three decimals keep the nanosecond precision
+	const auto flags     = stream.flags();
+	const auto precision = stream.precision();
+	stream.setf(std::ios::fixed, std::ios::floatfield);
+	stream.precision(3);
+
+	stream << "{\"traceEvents\":[";
+	for (u32 i = 0; i < events.size(); i++)
+	{
+		const ProfileEvent& event = events[i];
+
+		stream << (i == 0 ? "\n" : ",\n") << "{\"name\":\"";
+		WriteEscaped(stream, event.Name);
+		stream << "\",\"ph\":\"X\",\"ts\":" << static_cast<f64>(event.Start) / 1000.0
+		       << ",\"dur\":" << static_cast<f64>(event.End - event.Start) / 1000.0
+		       << ",\"pid\":0,\"tid\":" << event.ThreadIndex << '}';
+	}
+	stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+	stream.flags(flags);
+	stream.precision(precision);
+}
+
+bool Profiler::SaveChromeTrace(const std::string& path)
+{
+	std::ofstream file(path);
+	if (!file.is_open())
+		return false;
+
+	WriteChromeTrace(file);
+	return file.good();
+}
+
+void Profiler::Clear()
+{
+	ProfilerState& state = GetState();
+	const std::lock_guard<std::mutex> lock(state.collectMutex);
+	state.events.clear();
+}
+
+const std::vector<ProfileEvent>& Profiler::GetEvents()
+{
+	return GetState().events;
+}
+
+u64 Profiler::GetDroppedCount()
+{
+	ProfilerState& state = GetState();
+	const std::lock_guard<std::mutex> lock(state.ringMutex);
+
+	u64 dropped = 0;
+	for (const std::shared_ptr<EventRing>& ring : state.rings)
+	{
+		dropped += ring->dropped.load(std::memory_order_relaxed);
+	}
+	return dropped;
+}
+
+}
@@ -0,0 +1,624 @@
+#include <OtterML/RecordingGL.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+#include <unordered_map>
+
+#include <OtterML/GLExtensions.hpp>
+#include <OtterML/GLState.hpp>
+
+// Every entry point of the bundled GL 4.1 loader
+#define OTTER_GL_FUNCTIONS(X) \
+	X(glActiveShaderProgram) X(glActiveTexture) X(glAttachShader) X(glBeginConditionalRender) X(glBeginQuery) \
+	X(glBeginQueryIndexed) X(glBeginTransformFeedback) X(glBindAttribLocation) X(glBindBuffer) X(glBindBufferBase) \
+	X(glBindBufferRange) X(glBindFragDataLocation) X(glBindFragDataLocationIndexed) X(glBindFramebuffer) \
+	X(glBindProgramPipeline) X(glBindRenderbuffer) X(glBindSampler) X(glBindTexture) X(glBindTransformFeedback) \
+	X(glBindVertexArray) X(glBlendColor) X(glBlendEquation) X(glBlendEquationSeparate) X(glBlendEquationSeparatei) \
+	X(glBlendEquationi) X(glBlendFunc) X(glBlendFuncSeparate) X(glBlendFuncSeparatei) X(glBlendFunci) \
+	X(glBlitFramebuffer) X(glBufferData) X(glBufferSubData) X(glCheckFramebufferStatus) X(glClampColor) X(glClear) \
+	X(glClearBufferfi) X(glClearBufferfv) X(glClearBufferiv) X(glClearBufferuiv) X(glClearColor) X(glClearDepth) \
+	X(glClearDepthf) X(glClearStencil) X(glClientWaitSync) X(glColorMask) X(glColorMaski) X(glCompileShader) \
+	X(glCompressedTexImage1D) X(glCompressedTexImage2D) X(glCompressedTexImage3D) X(glCompressedTexSubImage1D) \
+	X(glCompressedTexSubImage2D) X(glCompressedTexSubImage3D) X(glCopyBufferSubData) X(glCopyTexImage1D) \
+	X(glCopyTexImage2D) X(glCopyTexSubImage1D) X(glCopyTexSubImage2D) X(glCopyTexSubImage3D) X(glCreateProgram) \
+	X(glCreateShader) X(glCreateShaderProgramv) X(glCullFace) X(glDeleteBuffers) X(glDeleteFramebuffers) \
+	X(glDeleteProgram) X(glDeleteProgramPipelines) X(glDeleteQueries) X(glDeleteRenderbuffers) X(glDeleteSamplers) \
+	X(glDeleteShader) X(glDeleteSync) X(glDeleteTextures) X(glDeleteTransformFeedbacks) X(glDeleteVertexArrays) \
+	X(glDepthFunc) X(glDepthMask) X(glDepthRange) X(glDepthRangeArrayv) X(glDepthRangeIndexed) X(glDepthRangef) \
+	X(glDetachShader) X(glDisable) X(glDisableVertexAttribArray) X(glDisablei) X(glDrawArrays) X(glDrawArraysIndirect) \
+	X(glDrawArraysInstanced) X(glDrawBuffer) X(glDrawBuffers) X(glDrawElements) X(glDrawElementsBaseVertex) \
+	X(glDrawElementsIndirect) X(glDrawElementsInstanced) X(glDrawElementsInstancedBaseVertex) X(glDrawRangeElements) \
+	X(glDrawRangeElementsBaseVertex) X(glDrawTransformFeedback) X(glDrawTransformFeedbackStream) X(glEnable) \
+	X(glEnableVertexAttribArray) X(glEnablei) X(glEndConditionalRender) X(glEndQuery) X(glEndQueryIndexed) \
+	X(glEndTransformFeedback) X(glFenceSync) X(glFinish) X(glFlush) X(glFlushMappedBufferRange) \
+	X(glFramebufferRenderbuffer) X(glFramebufferTexture) X(glFramebufferTexture1D) X(glFramebufferTexture2D) \
+	X(glFramebufferTexture3D) X(glFramebufferTextureLayer) X(glFrontFace) X(glGenBuffers) X(glGenFramebuffers) \
+	X(glGenProgramPipelines) X(glGenQueries) X(glGenRenderbuffers) X(glGenSamplers) X(glGenTextures) \
+	X(glGenTransformFeedbacks) X(glGenVertexArrays) X(glGenerateMipmap) X(glGetActiveAttrib) \
+	X(glGetActiveSubroutineName) X(glGetActiveSubroutineUniformName) X(glGetActiveSubroutineUniformiv) \
+	X(glGetActiveUniform) X(glGetActiveUniformBlockName) X(glGetActiveUniformBlockiv) X(glGetActiveUniformName) \
+	X(glGetActiveUniformsiv) X(glGetAttachedShaders) X(glGetAttribLocation) X(glGetBooleani_v) X(glGetBooleanv) \
+	X(glGetBufferParameteri64v) X(glGetBufferParameteriv) X(glGetBufferPointerv) X(glGetBufferSubData) \
+	X(glGetCompressedTexImage) X(glGetDoublei_v) X(glGetDoublev) X(glGetError) X(glGetFloati_v) X(glGetFloatv) \
+	X(glGetFragDataIndex) X(glGetFragDataLocation) X(glGetFramebufferAttachmentParameteriv) X(glGetInteger64i_v) \
+	X(glGetInteger64v) X(glGetIntegeri_v) X(glGetIntegerv) X(glGetMultisamplefv) X(glGetProgramBinary) \
+	X(glGetProgramInfoLog) X(glGetProgramPipelineInfoLog) X(glGetProgramPipelineiv) X(glGetProgramStageiv) \
+	X(glGetProgramiv) X(glGetQueryIndexediv) X(glGetQueryObjecti64v) X(glGetQueryObjectiv) X(glGetQueryObjectui64v) \
+	X(glGetQueryObjectuiv) X(glGetQueryiv) X(glGetRenderbufferParameteriv) X(glGetSamplerParameterIiv) \
+	X(glGetSamplerParameterIuiv) X(glGetSamplerParameterfv) X(glGetSamplerParameteriv) X(glGetShaderInfoLog) \
+	X(glGetShaderPrecisionFormat) X(glGetShaderSource) X(glGetShaderiv) X(glGetString) X(glGetStringi) \
+	X(glGetSubroutineIndex) X(glGetSubroutineUniformLocation) X(glGetSynciv) X(glGetTexImage) \
+	X(glGetTexLevelParameterfv) X(glGetTexLevelParameteriv) X(glGetTexParameterIiv) X(glGetTexParameterIuiv) \
+	X(glGetTexParameterfv) X(glGetTexParameteriv) X(glGetTransformFeedbackVarying) X(glGetUniformBlockIndex) \
+	X(glGetUniformIndices) X(glGetUniformLocation) X(glGetUniformSubroutineuiv) X(glGetUniformdv) X(glGetUniformfv) \
+	X(glGetUniformiv) X(glGetUniformuiv) X(glGetVertexAttribIiv) X(glGetVertexAttribIuiv) X(glGetVertexAttribLdv) \
+	X(glGetVertexAttribPointerv) X(glGetVertexAttribdv) X(glGetVertexAttribfv) X(glGetVertexAttribiv) X(glHint) \
+	X(glIsBuffer) X(glIsEnabled) X(glIsEnabledi) X(glIsFramebuffer) X(glIsProgram) X(glIsProgramPipeline) X(glIsQuery) \
+	X(glIsRenderbuffer) X(glIsSampler) X(glIsShader) X(glIsSync) X(glIsTexture) X(glIsTransformFeedback) \
+	X(glIsVertexArray) X(glLineWidth) X(glLinkProgram) X(glLogicOp) X(glMapBuffer) X(glMapBufferRange) \
+	X(glMinSampleShading) X(glMultiDrawArrays) X(glMultiDrawElements) X(glMultiDrawElementsBaseVertex) \
+	X(glPatchParameterfv) X(glPatchParameteri) X(glPauseTransformFeedback) X(glPixelStoref) X(glPixelStorei) \
+	X(glPointParameterf) X(glPointParameterfv) X(glPointParameteri) X(glPointParameteriv) X(glPointSize) \
+	X(glPolygonMode) X(glPolygonOffset) X(glPrimitiveRestartIndex) X(glProgramBinary) X(glProgramParameteri) \
+	X(glProgramUniform1d) X(glProgramUniform1dv) X(glProgramUniform1f) X(glProgramUniform1fv) X(glProgramUniform1i) \
+	X(glProgramUniform1iv) X(glProgramUniform1ui) X(glProgramUniform1uiv) X(glProgramUniform2d) X(glProgramUniform2dv) \
+	X(glProgramUniform2f) X(glProgramUniform2fv) X(glProgramUniform2i) X(glProgramUniform2iv) X(glProgramUniform2ui) \
+	X(glProgramUniform2uiv) X(glProgramUniform3d) X(glProgramUniform3dv) X(glProgramUniform3f) X(glProgramUniform3fv) \
+	X(glProgramUniform3i) X(glProgramUniform3iv) X(glProgramUniform3ui) X(glProgramUniform3uiv) X(glProgramUniform4d) \
+	X(glProgramUniform4dv) X(glProgramUniform4f) X(glProgramUniform4fv) X(glProgramUniform4i) X(glProgramUniform4iv) \
+	X(glProgramUniform4ui) X(glProgramUniform4uiv) X(glProgramUniformMatrix2dv) X(glProgramUniformMatrix2fv) \
+	X(glProgramUniformMatrix2x3dv) X(glProgramUniformMatrix2x3fv) X(glProgramUniformMatrix2x4dv) \
+	X(glProgramUniformMatrix2x4fv) X(glProgramUniformMatrix3dv) X(glProgramUniformMatrix3fv) \
+	X(glProgramUniformMatrix3x2dv) X(glProgramUniformMatrix3x2fv) X(glProgramUniformMatrix3x4dv) \
+	X(glProgramUniformMatrix3x4fv) X(glProgramUniformMatrix4dv) X(glProgramUniformMatrix4fv) \
+	X(glProgramUniformMatrix4x2dv) X(glProgramUniformMatrix4x2fv) X(glProgramUniformMatrix4x3dv) \
+	X(glProgramUniformMatrix4x3fv) X(glProvokingVertex) X(glQueryCounter) X(glReadBuffer) X(glReadPixels) \
+	X(glReleaseShaderCompiler) X(glRenderbufferStorage) X(glRenderbufferStorageMultisample) X(glResumeTransformFeedback) \
+	X(glSampleCoverage) X(glSampleMaski) X(glSamplerParameterIiv) X(glSamplerParameterIuiv) X(glSamplerParameterf) \
+	X(glSamplerParameterfv) X(glSamplerParameteri) X(glSamplerParameteriv) X(glScissor) X(glScissorArrayv) \
+	X(glScissorIndexed) X(glScissorIndexedv) X(glShaderBinary) X(glShaderSource) X(glStencilFunc) \
+	X(glStencilFuncSeparate) X(glStencilMask) X(glStencilMaskSeparate) X(glStencilOp) X(glStencilOpSeparate) \
+	X(glTexBuffer) X(glTexImage1D) X(glTexImage2D) X(glTexImage2DMultisample) X(glTexImage3D) X(glTexImage3DMultisample) \
+	X(glTexParameterIiv) X(glTexParameterIuiv) X(glTexParameterf) X(glTexParameterfv) X(glTexParameteri) \
+	X(glTexParameteriv) X(glTexSubImage1D) X(glTexSubImage2D) X(glTexSubImage3D) X(glTransformFeedbackVaryings) \
+	X(glUniform1d) X(glUniform1dv) X(glUniform1f) X(glUniform1fv) X(glUniform1i) X(glUniform1iv) X(glUniform1ui) \
+	X(glUniform1uiv) X(glUniform2d) X(glUniform2dv) X(glUniform2f) X(glUniform2fv) X(glUniform2i) X(glUniform2iv) \
+	X(glUniform2ui) X(glUniform2uiv) X(glUniform3d) X(glUniform3dv) X(glUniform3f) X(glUniform3fv) X(glUniform3i) \
+	X(glUniform3iv) X(glUniform3ui) X(glUniform3uiv) X(glUniform4d) X(glUniform4dv) X(glUniform4f) X(glUniform4fv) \
+	X(glUniform4i) X(glUniform4iv) X(glUniform4ui) X(glUniform4uiv) X(glUniformBlockBinding) X(glUniformMatrix2dv) \
+	X(glUniformMatrix2fv) X(glUniformMatrix2x3dv) X(glUniformMatrix2x3fv) X(glUniformMatrix2x4dv) \
+	X(glUniformMatrix2x4fv) X(glUniformMatrix3dv) X(glUniformMatrix3fv) X(glUniformMatrix3x2dv) X(glUniformMatrix3x2fv) \
+	X(glUniformMatrix3x4dv) X(glUniformMatrix3x4fv) X(glUniformMatrix4dv) X(glUniformMatrix4fv) X(glUniformMatrix4x2dv) \
+	X(glUniformMatrix4x2fv) X(glUniformMatrix4x3dv) X(glUniformMatrix4x3fv) X(glUniformSubroutinesuiv) X(glUnmapBuffer) \
+	X(glUseProgram) X(glUseProgramStages) X(glValidateProgram) X(glValidateProgramPipeline) X(glVertexAttrib1d) \
+	X(glVertexAttrib1dv) X(glVertexAttrib1f) X(glVertexAttrib1fv) X(glVertexAttrib1s) X(glVertexAttrib1sv) \
+	X(glVertexAttrib2d) X(glVertexAttrib2dv) X(glVertexAttrib2f) X(glVertexAttrib2fv) X(glVertexAttrib2s) \
+	X(glVertexAttrib2sv) X(glVertexAttrib3d) X(glVertexAttrib3dv) X(glVertexAttrib3f) X(glVertexAttrib3fv) \
+	X(glVertexAttrib3s) X(glVertexAttrib3sv) X(glVertexAttrib4Nbv) X(glVertexAttrib4Niv) X(glVertexAttrib4Nsv) \
+	X(glVertexAttrib4Nub) X(glVertexAttrib4Nubv) X(glVertexAttrib4Nuiv) X(glVertexAttrib4Nusv) X(glVertexAttrib4bv) \
+	X(glVertexAttrib4d) X(glVertexAttrib4dv) X(glVertexAttrib4f) X(glVertexAttrib4fv) X(glVertexAttrib4iv) \
+	X(glVertexAttrib4s) X(glVertexAttrib4sv) X(glVertexAttrib4ubv) X(glVertexAttrib4uiv) X(glVertexAttrib4usv) \
+	X(glVertexAttribDivisor) X(glVertexAttribI1i) X(glVertexAttribI1iv) X(glVertexAttribI1ui) X(glVertexAttribI1uiv) \
+	X(glVertexAttribI2i) X(glVertexAttribI2iv) X(glVertexAttribI2ui) X(glVertexAttribI2uiv) X(glVertexAttribI3i) \
+	X(glVertexAttribI3iv) X(glVertexAttribI3ui) X(glVertexAttribI3uiv) X(glVertexAttribI4bv) X(glVertexAttribI4i) \
+	X(glVertexAttribI4iv) X(glVertexAttribI4sv) X(glVertexAttribI4ubv) X(glVertexAttribI4ui) X(glVertexAttribI4uiv) \
+	X(glVertexAttribI4usv) X(glVertexAttribIPointer) X(glVertexAttribL1d) X(glVertexAttribL1dv) X(glVertexAttribL2d) \
+	X(glVertexAttribL2dv) X(glVertexAttribL3d) X(glVertexAttribL3dv) X(glVertexAttribL4d) X(glVertexAttribL4dv) \
+	X(glVertexAttribLPointer) X(glVertexAttribP1ui) X(glVertexAttribP1uiv) X(glVertexAttribP2ui) X(glVertexAttribP2uiv) \
+	X(glVertexAttribP3ui) X(glVertexAttribP3uiv) X(glVertexAttribP4ui) X(glVertexAttribP4uiv) X(glVertexAttribPointer) \
+	X(glViewport) X(glViewportArrayv) X(glViewportIndexedf) X(glViewportIndexedfv) X(glWaitSync)
+
+namespace oter
+{
+
+namespace
+{
+
+struct RecorderState
+{
+public:
+	bool                                      logging = true;
+	std::vector<GLCall>                       calls;
+	std::unordered_map<std::string_view, u64> callCounts;
+	u64                                       callCount     = 0;
+	u64                                       uploadedBytes = 0;
+
+	u32         majorVersion = 4;
+	u32         minorVersion = 1;
+	std::string version;
+
+	u32                                      nextName = 1;
+	std::unordered_map<u32, u32>             boundBuffers; // Target to buffer
+	std::unordered_map<u32, std::vector<u8>> bufferContents;
+
+	std::unordered_map<std::string_view, GLADapiproc> procs;
+};
+
+RecorderState state;
+
+template <typename T>
+void AppendArgument(std::string& out, const T value)
+{
+	char text[32];
+	if constexpr (std::is_pointer_v<T>)
+	{
+		if (value == nullptr)
+			out += "null";
+		else
+			out += (snprintf(text, sizeof(text), "%p", reinterpret_cast<const void*>(value)), text);
+	}
+	else if constexpr (std::is_floating_point_v<T>)
+	{
+		out += (snprintf(text, sizeof(text), "%g", static_cast<f64>(value)), text);
+	}
+	else
+	{
+		// Promotes GLboolean and other character types so they print as numbers
+		out += std::to_string(+value);
+	}
+}
+
+template <typename... Args>
+void Record(const char* name, const Args... args)
+{
+	state.callCount++;
+	state.callCounts[name]++;
+
+	if (!state.logging)
+		return;
+
+	GLCall call;
+	call.Name = name;
+
+	bool first = true;
+	((call.Arguments += first ? "" : ", ", AppendArgument(call.Arguments, args), first = false), ...);
+
+	state.calls.push_back(std::move(call));
+}
+
+template <size_t N>
+struct StubName
+{
+public:
+	char value[N];
+
+	constexpr StubName(const char (&name)[N])
+	{
+		std::copy_n(name, N, this->value);
+	}
+};
+
+// Records the call and returns a zero result; entry points that need to behave are overridden below
+template <StubName Name, typename Function>
+struct GenericStub;
+
+template <StubName Name, typename Result, typename... Args>
+struct GenericStub<Name, Result(GLAD_API_PTR*)(Args...)>
+{
+public:
+	static Result GLAD_API_PTR Call(Args... args)
+	{
+		Record(Name.value, args...);
+		if constexpr (!std::is_void_v<Result>)
+			return Result();
+	}
+};
+
+void GenerateNames(const GLsizei count, GLuint* names)
+{
+	for (GLsizei i = 0; i < count; i++)
+	{
+		names[i] = state.nextName++;
+	}
+}
+
+std::vector<u8>& BoundStorage(const GLenum target)
+{
+	return state.bufferContents[state.boundBuffers[target]];
+}
+
+u64 TexelSize(const GLenum format, const GLenum type)
+{
+	u64 components = 4;
+	switch (format)
+	{
+	case GL_RED:
+	case GL_DEPTH_COMPONENT:
+		components = 1;
+		break;
+	case GL_RG:
+		components = 2;
+		break;
+	case GL_RGB:
+	case GL_BGR:
+		components = 3;
+		break;
+	case GL_DEPTH_STENCIL:
+		return 4;
+	}
+
+	switch (type)
+	{
+	case GL_UNSIGNED_BYTE:
+	case GL_BYTE:
+		return components;
+	case GL_UNSIGNED_SHORT:
+	case GL_SHORT:
+	case GL_HALF_FLOAT:
+		return components * 2;
+	case GL_UNSIGNED_INT:
+	case GL_INT:
+	case GL_FLOAT:
+		return components * 4;
+	default:
+		// Packed types hold a whole texel
+		return 4;
+	}
+}
+
+const GLubyte* GLAD_API_PTR GetString(const GLenum name)
+{
+	Record("glGetString", name);
+	switch (name)
+	{
+	case GL_VERSION:
+		return reinterpret_cast<const GLubyte*>(state.version.c_str());
+	case GL_VENDOR:
+		return reinterpret_cast<const GLubyte*>("OtterML");
+	case GL_RENDERER:
+		return reinterpret_cast<const GLubyte*>("OtterML RecordingGL");
+	case GL_SHADING_LANGUAGE_VERSION:
+		return reinterpret_cast<const GLubyte*>("4.10");
+	default:
+		return reinterpret_cast<const GLubyte*>("");
+	}
+}
+
+const GLubyte* GLAD_API_PTR GetStringi(const GLenum name, const GLuint index)
+{
+	Record("glGetStringi", name, index);
+	return reinterpret_cast<const GLubyte*>("");
+}
+
+void GLAD_API_PTR GetIntegerv(const GLenum name, GLint* data)
+{
+	Record("glGetIntegerv", name, data);
+	switch (name)
+	{
+	case GL_MAJOR_VERSION:
+		*data = static_cast<GLint>(state.majorVersion);
+		break;
+	case GL_MINOR_VERSION:
+		*data = static_cast<GLint>(state.minorVersion);
+		break;
+	default:
+		*data = 0;
+		break;
+	}
+}
+
+void GLAD_API_PTR GenBuffers(const GLsizei count, GLuint* names)
+{
+	Record("glGenBuffers", count, names);
+	GenerateNames(count, names);
+}
+
+void GLAD_API_PTR GenTextures(const GLsizei count, GLuint* names)
+{
+	Record("glGenTextures", count, names);
+	GenerateNames(count, names);
+}
+
+void GLAD_API_PTR GenVertexArrays(const GLsizei count, GLuint* names)
+{
+	Record("glGenVertexArrays", count, names);
+	GenerateNames(count, names);
+}
+
+void GLAD_API_PTR GenFramebuffers(const GLsizei count, GLuint* names)
+{
+	Record("glGenFramebuffers", count, names);
+	GenerateNames(count, names);
+}
+
+void GLAD_API_PTR GenRenderbuffers(const GLsizei count, GLuint* names)
+{
+	Record("glGenRenderbuffers", count, names);
+	GenerateNames(count, names);
+}
+
+void GLAD_API_PTR GenQueries(const GLsizei count, GLuint* names)
+{
+	Record("glGenQueries", count, names);
+	GenerateNames(count, names);
+}
+
+GLuint GLAD_API_PTR CreateShader(const GLenum type)
+{
+	Record("glCreateShader", type);
+	return state.nextName++;
+}
+
+GLuint GLAD_API_PTR CreateProgram()
+{
+	Record("glCreateProgram");
+	return state.nextName++;
+}
+
+void GLAD_API_PTR GetShaderiv(const GLuint shader, const GLenum name, GLint* params)
+{
+	Record("glGetShaderiv", shader, name, params);
+	*params = name == GL_COMPILE_STATUS ? GL_TRUE : 0;
+}
+
+void GLAD_API_PTR GetProgramiv(const GLuint program, const GLenum name, GLint* params)
+{
+	Record("glGetProgramiv", program, name, params);
+	*params = name == GL_LINK_STATUS ? GL_TRUE : 0;
+}
+
+void GLAD_API_PTR GetShaderInfoLog(const GLuint shader, const GLsizei bufferSize, GLsizei* length, GLchar* log)
+{
+	Record("glGetShaderInfoLog", shader, bufferSize, length, log);
+	if (length != nullptr)
+		*length = 0;
+	if (bufferSize > 0)
+		log[0] = '\0';
+}
+
+void GLAD_API_PTR GetProgramInfoLog(const GLuint program, const GLsizei bufferSize, GLsizei* length, GLchar* log)
+{
+	Record("glGetProgramInfoLog", program, bufferSize, length, log);
+	if (length != nullptr)
+		*length = 0;
+	if (bufferSize > 0)
+		log[0] = '\0';
+}
+
+GLenum GLAD_API_PTR CheckFramebufferStatus(const GLenum target)
+{
+	Record("glCheckFramebufferStatus", target);
+	return GL_FRAMEBUFFER_COMPLETE;
+}
+
+void GLAD_API_PTR GetQueryObjectiv(const GLuint query, const GLenum name, GLint* params)
+{
+	Record("glGetQueryObjectiv", query, name, params);
+	*params = name == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0;
+}
+
+void GLAD_API_PTR GetQueryObjectui64v(const GLuint query, const GLenum name, GLuint64* params)
+{
+	Record("glGetQueryObjectui64v", query, name, params);
+	*params = 0;
+}
+
+GLsync GLAD_API_PTR FenceSync(const GLenum condition, const GLbitfield flags)
+{
+	Record("glFenceSync", condition, flags);
+	return reinterpret_cast<GLsync>(static_cast<uintptr_t>(state.nextName++));
+}
+
+GLenum GLAD_API_PTR ClientWaitSync(const GLsync sync, const GLbitfield flags, const GLuint64 timeout)
+{
+	Record("glClientWaitSync", sync, flags, timeout);
+	return GL_ALREADY_SIGNALED;
+}
+
+void GLAD_API_PTR BindBuffer(const GLenum target, const GLuint buffer)
+{
+	Record("glBindBuffer", target, buffer);
+	state.boundBuffers[target] = buffer;
+}
+
+void GLAD_API_PTR DeleteBuffers(const GLsizei count, const GLuint* buffers)
+{
+	Record("glDeleteBuffers", count, buffers);
+	for (GLsizei i = 0; i < count; i++)
+	{
+		state.bufferContents.erase(buffers[i]);
+	}
+}
+
+void GLAD_API_PTR BufferData(const GLenum target, const GLsizeiptr size, const void* data, const GLenum usage)
+{
+	Record("glBufferData", target, size, data, usage);
+
+	std::vector<u8>& storage = BoundStorage(target);
+	storage.assign(static_cast<size_t>(size), 0);
+	if (data != nullptr)
+	{
+		memcpy(storage.data(), data, static_cast<size_t>(size));
+		state.uploadedBytes += static_cast<u64>(size);
+	}
+}
+
+void GLAD_API_PTR BufferStorage(const GLenum target, const GLsizeiptr size, const void* data, const GLbitfield flags)
+{
+	Record("glBufferStorage", target, size, data, flags);
+
+	std::vector<u8>& storage = BoundStorage(target);
+	storage.assign(static_cast<size_t>(size), 0);
+	if (data != nullptr)
+	{
+		memcpy(storage.data(), data, static_cast<size_t>(size));
+		state.uploadedBytes += static_cast<u64>(size);
+	}
+}
+
+void GLAD_API_PTR BufferSubData(const GLenum target, const GLintptr offset, const GLsizeiptr size, const void* data)
+{
+	Record("glBufferSubData", target, offset, size, data);
+
+	std::vector<u8>& storage = BoundStorage(target);
+	storage.resize(std::max(storage.size(), static_cast<size_t>(offset + size)));
+	memcpy(storage.data() + offset, data, static_cast<size_t>(size));
+	state.uploadedBytes += static_cast<u64>(size);
+}
+
+void* GLAD_API_PTR MapBufferRange(const GLenum target, const GLintptr offset, const GLsizeiptr length,
+                                  const GLbitfield access)
+{
+	Record("glMapBufferRange", target, offset, length, access);
+
+	// Persistent mappings outlive this call, so the storage must not move; buffers are sized before they are mapped
+	std::vector<u8>& storage = BoundStorage(target);
+	if (storage.size() < static_cast<size_t>(offset + length))
+		storage.resize(static_cast<size_t>(offset + length));
+
+	state.uploadedBytes += static_cast<u64>(length);
+	return storage.data() + offset;
+}
+
+GLboolean GLAD_API_PTR UnmapBuffer(const GLenum target)
+{
+	Record("glUnmapBuffer", target);
+	return GL_TRUE;
+}
+
+void GLAD_API_PTR TexImage2D(const GLenum target, const GLint level, const GLint internalFormat, const GLsizei width,
+                             const GLsizei height, const GLint border, const GLenum format, const GLenum type,
+                             const void* pixels)
+{
+	Record("glTexImage2D", target, level, internalFormat, width, height, border, format, type, pixels);
+	if (pixels != nullptr)
+		state.uploadedBytes += static_cast<u64>(width) * static_cast<u64>(height) * TexelSize(format, type);
+}
+
+void GLAD_API_PTR TexSubImage2D(const GLenum target, const GLint level, const GLint x, const GLint y,
+                                const GLsizei width, const GLsizei height, const GLenum format, const GLenum type,
+                                const void* pixels)
+{
+	Record("glTexSubImage2D", target, level, x, y, width, height, format, type, pixels);
+	if (pixels != nullptr)
+		state.uploadedBytes += static_cast<u64>(width) * static_cast<u64>(height) * TexelSize(format, type);
+}
+
+void GLAD_API_PTR ReadPixels(const GLint x, const GLint y, const GLsizei width, const GLsizei height,
+                             const GLenum format, const GLenum type, void* pixels)
+{
+	Record("glReadPixels", x, y, width, height, format, type, pixels);
+	memset(pixels, 0, static_cast<size_t>(width) * static_cast<size_t>(height) * TexelSize(format, type));
+}
+
+template <typename Function>
+void Override(const char* name, const Function function)
+{
+	state.procs[name] = reinterpret_cast<GLADapiproc>(function);
+}
+
+void BuildProcs()
+{
+#define OTTER_GL_GENERIC_STUB(name) \
+	state.procs[#name] = reinterpret_cast<GLADapiproc>(&GenericStub<#name, decltype(glad_##name)>::Call);
+	OTTER_GL_FUNCTIONS(OTTER_GL_GENERIC_STUB)
+#undef OTTER_GL_GENERIC_STUB
+
+	state.procs["glMultiDrawElementsIndirect"] = reinterpret_cast<GLADapiproc>(
+		&GenericStub<"glMultiDrawElementsIndirect", GLExtensionFunctions::MultiDrawElementsIndirectFunc>::Call);
+
+	Override("glGetString", &GetString);
+	Override("glGetStringi", &GetStringi);
+	Override("glGetIntegerv", &GetIntegerv);
+	Override("glGenBuffers", &GenBuffers);
+	Override("glGenTextures", &GenTextures);
+	Override("glGenVertexArrays", &GenVertexArrays);
+	Override("glGenFramebuffers", &GenFramebuffers);
+	Override("glGenRenderbuffers", &GenRenderbuffers);
+	Override("glGenQueries", &GenQueries);
+	Override("glCreateShader", &CreateShader);
+	Override("glCreateProgram", &CreateProgram);
+	Override("glGetShaderiv", &GetShaderiv);
+	Override("glGetProgramiv", &GetProgramiv);
+	Override("glGetShaderInfoLog", &GetShaderInfoLog);
+	Override("glGetProgramInfoLog", &GetProgramInfoLog);
+	Override("glCheckFramebufferStatus", &CheckFramebufferStatus);
+	Override("glGetQueryObjectiv", &GetQueryObjectiv);
+	Override("glGetQueryObjectui64v", &GetQueryObjectui64v);
+	Override("glFenceSync", &FenceSync);
+	Override("glClientWaitSync", &ClientWaitSync);
+	Override("glBindBuffer", &BindBuffer);
+	Override("glDeleteBuffers", &DeleteBuffers);
+	Override("glBufferData", &BufferData);
+	Override("glBufferStorage", &BufferStorage);
+	Override("glBufferSubData", &BufferSubData);
+	Override("glMapBufferRange", &MapBufferRange);
+	Override("glUnmapBuffer", &UnmapBuffer);
+	Override("glTexImage2D", &TexImage2D);
+	Override("glTexSubImage2D", &TexSubImage2D);
+	Override("glReadPixels", &ReadPixels);
+}
+
+}
+
+bool RecordingGL::Install(const u32 majorVersion, const u32 minorVersion)
+{
+	if (state.procs.empty())
+		BuildProcs();
+
+	state.majorVersion = majorVersion;
+	state.minorVersion = minorVersion;
+	state.version      = std::to_string(majorVersion) + "." + std::to_string(minorVersion) + " OtterML RecordingGL";
+
+	state.nextName = 1;
+	state.boundBuffers.clear();
+	state.bufferContents.clear();
+
+	const bool loaded = LoadGL(&RecordingGL::GetProcAddress);
+	GLState::Invalidate();
+	Clear();
+	return loaded;
+}
+
+GLADapiproc RecordingGL::GetProcAddress(const char* name)
+{
+	const auto iter = state.procs.find(name);
+	return iter == state.procs.end() ? nullptr : iter->second;
+}
+
+void RecordingGL::SetLogging(const bool logging)
+{
+	state.logging = logging;
+}
+
+void RecordingGL::Clear()
+{
+	state.calls.clear();
+	state.callCounts.clear();
+	state.callCount     = 0;
+	state.uploadedBytes = 0;
+}
+
+const std::vector<GLCall>& RecordingGL::GetCalls()
+{
+	return state.calls;
+}
+
+u64 RecordingGL::GetCallCount()
+{
+	return state.callCount;
+}
+
+u64 RecordingGL::GetCallCount(const std::string_view name)
+{
+	const auto iter = state.callCounts.find(name);
+	return iter == state.callCounts.end() ? 0 : iter->second;
+}
+
+u64 RecordingGL::GetUploadedBytes()
+{
+	return state.uploadedBytes;
+}
+
+std::span<const u8> RecordingGL::GetBufferContents(const u32 buffer)
+{
+	const auto iter = state.bufferContents.find(buffer);
+	if (iter == state.bufferContents.end())
+		return {};
+
+	return iter->second;
+}
+
+}
@@ -0,0 +1,275 @@
+#include <OtterML/RenderGraph.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+
+#include <OtterML/Profiler.hpp>
+
+namespace oter
+{
+
+RenderGraph::RenderGraph(FrameBufferPool& pool)
+	: _pool(pool) {}
+
+RenderGraph::Resource RenderGraph::CreateTransient(const std::string& name, const FrameBufferFormat& format)
+{
+	ResourceNode resource;
+	resource.name   = name;
+	resource.format = format;
+	return this->AddResource(std::move(resource));
+}
+
+RenderGraph::Resource RenderGraph::Import(const std::string& name, FrameBuffer& frameBuffer)
+{
+	ResourceNode resource;
+	resource.name        = name;
+	resource.format      = frameBuffer.GetFormat();
+	resource.frameBuffer = &frameBuffer;
+	resource.imported    = true;
+	return this->AddResource(std::move(resource));
+}
+
+RenderGraph::Resource RenderGraph::ImportBackBuffer(const Vector2<u32>& size)
+{
+	ResourceNode resource;
+	resource.name        = "BackBuffer";
+	resource.format.Size = size;
+	resource.imported    = true;
+	resource.backBuffer  = true;
+	return this->AddResource(std::move(resource));
+}
+
+void RenderGraph::AddPass(const std::string& name, const std::vector<Resource>& reads, const Resource target,
+                          const PassFunction& execute)
+{
+	for (const Resource read : reads)
+	{
+		if (this->GetResource(read).backBuffer)
+			throw std::invalid_argument("RenderGraph pass \"" + name + "\" cannot read the back buffer.");
+		if (read == target)
+			throw std::invalid_argument("RenderGraph pass \"" + name + "\" cannot read the resource it writes.");
+	}
+
+	const ResourceNode& resource = this->GetResource(target);
+	if (resource.writer != NONE)
+		throw std::invalid_argument("RenderGraph resource \"" + resource.name + "\" already has a pass writing it.");
+
+	this->_resources[target].writer = static_cast<u32>(this->_passes.size());
+	this->_passes.push_back({ name, reads, target, execute });
+}
+
+void RenderGraph::Execute()
+{
+	OTTERML_PROFILE_ZONE("RenderGraph::Execute");
+
+	this->Compile();
+
+	std::vector<const FrameBuffer*> used;
+
+	for (u32 i = 0; i < this->_order.size(); i++)
+	{
+		const PassNode& pass   = this->_passes[this->_order[i]];
+		ResourceNode&   target = this->_resources[pass.target];
+
+		if (!target.imported)
+		{
+			target.frameBuffer = &this->_pool.Acquire(target.format);
+			if (std::find(used.begin(), used.end(), target.frameBuffer) == used.end())
+				used.push_back(target.frameBuffer);
+		}
+
+		for (const Resource read : pass.reads)
+		{
+			if (this->_resources[read].frameBuffer != nullptr)
+				this->_resources[read].frameBuffer->Resolve();
+		}
+
+		if (target.backBuffer)
+			FrameBuffer::BindDefault(target.format.Size);
+		else
+			target.frameBuffer->Bind();
+
+		pass.execute(*this);
+
+		// Hand transients back as soon as nothing later needs them, so the next one can reuse the FrameBuffer
+		const auto release = [&](ResourceNode& resource)
+		{
+			if (!resource.imported && resource.lastUse == i && resource.frameBuffer != nullptr)
+			{
+				this->_pool.Release(*resource.frameBuffer);
+				resource.frameBuffer = nullptr;
+			}
+		};
+		for (const Resource read : pass.reads)
+		{
+			release(this->_resources[read]);
+		}
+		release(target);
+	}
+
+	this->_transientFrameBufferCount = static_cast<u32>(used.size());
+}
+
+void RenderGraph::Reset()
+{
+	this->_resources.clear();
+	this->_passes.clear();
+	this->_order.clear();
+}
+
+const Texture2D& RenderGraph::GetTexture(const Resource resource) const
+{
+	return this->GetFrameBuffer(resource).GetColorTexture();
+}
+
+const FrameBuffer& RenderGraph::GetFrameBuffer(const Resource resource) const
+{
+	const ResourceNode& node = this->GetResource(resource);
+	if (node.frameBuffer == nullptr)
+		throw std::logic_error("RenderGraph resource \"" + node.name + "\" has no FrameBuffer at this point.");
+
+	return *node.frameBuffer;
+}
+
+std::vector<std::string> RenderGraph::GetExecutionOrder() const
+{
+	std::vector<std::string> names;
+	names.reserve(this->_order.size());
+	for (const u32 pass : this->_order)
+	{
+		names.push_back(this->_passes[pass].name);
+	}
+	return names;
+}
+
+u32 RenderGraph::GetCulledPassCount() const
+{
+	return this->_culledPassCount;
+}
+
+u32 RenderGraph::GetTransientFrameBufferCount() const
+{
+	return this->_transientFrameBufferCount;
+}
+
+RenderGraph::Resource RenderGraph::AddResource(ResourceNode&& resource)
+{
+	this->_resources.push_back(std::move(resource));
+	return static_cast<Resource>(this->_resources.size() - 1);
+}
+
+void RenderGraph::Compile()
+{
+	const u32 passCount = static_cast<u32>(this->_passes.size());
+
+	// Walk back from the passes that write outputs; anything not reached is culled
+	std::vector<u8>  needed(passCount, false);
+	std::vector<u32> pending;
+	for (u32 i = 0; i < passCount; i++)
+	{
+		if (this->_resources[this->_passes[i].target].imported)
+		{
+			needed[i] = true;
+			pending.push_back(i);
+		}
+	}
+	while (!pending.empty())
+	{
+		const u32 pass = pending.back();
+		pending.pop_back();
+
+		for (const Resource read : this->_passes[pass].reads)
+		{
+			const ResourceNode& resource = this->_resources[read];
+			if (resource.writer == NONE)
+			{
+				if (!resource.imported)
+					throw std::logic_error("RenderGraph resource \"" + resource.name + "\" is read but never written.");
+				continue;
+			}
+			if (!needed[resource.writer])
+			{
+				needed[resource.writer] = true;
+				pending.push_back(resource.writer);
+			}
+		}
+	}
+
+	// Kahn's algorithm, taking the earliest added ready pass first so ties keep the order passes were added in
+	std::vector<u32>              waitingOn(passCount, 0);
+	std::vector<std::vector<u32>> dependents(passCount);
+	for (u32 i = 0; i < passCount; i++)
+	{
+		if (!needed[i])
+			continue;
+
+		for (const Resource read : this->_passes[i].reads)
+		{
+			const u32 writer = this->_resources[read].writer;
+			if (writer != NONE)
+			{
+				waitingOn[i]++;
+				dependents[writer].push_back(i);
+			}
+		}
+	}
+
+	std::priority_queue<u32, std::vector<u32>, std::greater<>> ready;
+	u32                                                        neededCount = 0;
+	for (u32 i = 0; i < passCount; i++)
+	{
+		if (!needed[i])
+			continue;
+
+		neededCount++;
+		if (waitingOn[i] == 0)
+			ready.push(i);
+	}
+
+	this->_order.clear();
+	while (!ready.empty())
+	{
+		const u32 pass = ready.top();
+		ready.pop();
+		this->_order.push_back(pass);
+
+		for (const u32 dependent : dependents[pass])
+		{
+			if (--waitingOn[dependent] == 0)
+				ready.push(dependent);
+		}
+	}
+
+	if (this->_order.size() != neededCount)
+		throw std::logic_error("RenderGraph passes form a cycle.");
+
+	this->_culledPassCount = passCount - neededCount;
+
+	for (ResourceNode& resource : this->_resources)
+	{
+		resource.lastUse = NONE;
+	}
+	for (u32 i = 0; i < this->_order.size(); i++)
+	{
+		const PassNode& pass = this->_passes[this->_order[i]];
+		for (const Resource read : pass.reads)
+		{
+			this->_resources[read].lastUse = i;
+		}
+
+		// The writer always runs before its readers, so any reader overwrites this
+		this->_resources[pass.target].lastUse = i;
+	}
+}
+
+const RenderGraph::ResourceNode& RenderGraph::GetResource(const Resource resource) const
+{
+	if (resource >= this->_resources.size())
+		throw std::out_of_range("RenderGraph resource does not exist.");
+
+	return this->_resources[resource];
+}
+
+}
@@ -0,0 +1,200 @@
+#include <OtterML/RenderQueue.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <glad/gl.h>
+#include <OtterML/GLState.hpp>
+#include <OtterML/Profiler.hpp>
+#include <OtterML/RenderStats.hpp>
+#include <OtterML/Shader.hpp>
+#include <OtterML/Texture2D.hpp>
+
+namespace oter
+{
+
+void RenderCommandList::Add(const RenderCommand& command)
+{
+	// Rejected here rather than at Execute(), where the recording thread is no longer known
+	if (command.Program == nullptr)
+		throw std::invalid_argument("RenderCommand needs a program to draw with.");
+
+	this->_commands.push_back(command);
+}
+
+void RenderCommandList::Clear()
+{
+	this->_commands.clear();
+}
+
+u32 RenderCommandList::GetCount() const
+{
+	return static_cast<u32>(this->_commands.size());
+}
+
+RenderQueue::RenderQueue(const u32 listCount)
+{
+	this->SetListCount(listCount);
+}
+
+u64 RenderQueue::MakeKey(const u8 layer, const u32 shaderID, const u32 textureID, const f32 depth)
+{
+	constexpr u64 depthMax = (1ull << DEPTH_BITS) - 1;
+
+	const f32 clamped = std::clamp(depth, 0.f, 1.f);
+
+	u64 key = layer;
+	key     = key << SHADER_BITS | (shaderID & ((1u << SHADER_BITS) - 1));
+	key     = key << TEXTURE_BITS | (textureID & ((1u << TEXTURE_BITS) - 1));
+	key     = key << DEPTH_BITS | static_cast<u64>(clamped * static_cast<f32>(depthMax));
+	return key;
+}
+
+void RenderQueue::SetListCount(const u32 listCount)
+{
+	this->_lists.resize(std::max(listCount, 1u));
+}
+
+u32 RenderQueue::GetListCount() const
+{
+	return static_cast<u32>(this->_lists.size());
+}
+
+RenderCommandList& RenderQueue::GetList(const u32 index)
+{
+	if (index >= this->_lists.size())
+		throw std::out_of_range("RenderQueue command list index is out of range.");
+
+	return this->_lists[index];
+}
+
+void RenderQueue::Execute()
+{
+	OTTERML_PROFILE_ZONE("RenderQueue::Execute");
+
+	this->_drawCount        = 0;
+	this->_stateChangeCount = 0;
+
+	// Merge in list order, so equal keys keep a deterministic order no matter which thread recorded what
+	this->_merged.clear();
+	for (RenderCommandList& list : this->_lists)
+	{
+		this->_merged.insert(this->_merged.end(), list._commands.begin(), list._commands.end());
+		list.Clear();
+	}
+
+	if (this->_merged.empty())
+		return;
+
+	this->Sort();
+
+	const Shader*    program     = nullptr;
+	const Texture2D* texture     = nullptr;
+	u32              vertexArray = UINT32_MAX;
+
+	GLState::ActiveTexture(0);
+	for (const SortEntry& entry : this->_entries)
+	{
+		const RenderCommand& command = this->_merged[entry.index];
+
+		if (command.Program != program)
+		{
+			program = command.Program;
+			program->Use();
+			this->_stateChangeCount++;
+		}
+		if (command.Texture != texture && command.Texture != nullptr)
+		{
+			texture = command.Texture;
+			texture->Bind();
+			this->_stateChangeCount++;
+		}
+		if (command.VertexArray != vertexArray)
+		{
+			vertexArray = command.VertexArray;
+			GLState::BindVertexArray(vertexArray);
+			this->_stateChangeCount++;
+		}
+
+		const i32 count = static_cast<i32>(command.Count);
+		if (command.Indexed)
+		{
+			void* indices = reinterpret_cast<void*>(static_cast<size_t>(command.First) * sizeof(u32));
+			if (command.InstanceCount == 1)
+				glDrawElements(command.Mode, count, GL_UNSIGNED_INT, indices);
+			else
+				glDrawElementsInstanced(command.Mode, count, GL_UNSIGNED_INT, indices, static_cast<i32>(command.InstanceCount));
+		}
+		else
+		{
+			if (command.InstanceCount == 1)
+				glDrawArrays(command.Mode, static_cast<i32>(command.First), count);
+			else
+				glDrawArraysInstanced(command.Mode, static_cast<i32>(command.First), count, static_cast<i32>(command.InstanceCount));
+		}
+		RenderStats::AddDraw(command.Mode, command.Count, command.InstanceCount);
+		this->_drawCount++;
+	}
+
+	GLState::BindVertexArray(0);
+}
+
+void RenderQueue::Clear()
+{
+	for (RenderCommandList& list : this->_lists)
+	{
+		list.Clear();
+	}
+}
+
+u32 RenderQueue::GetDrawCount() const
+{
+	return this->_drawCount;
+}
+
+u32 RenderQueue::GetStateChangeCount() const
+{
+	return this->_stateChangeCount;
+}
+
+void RenderQueue::Sort()
+{
+	const u32 count = static_cast<u32>(this->_merged.size());
+
+	this->_entries.resize(count);
+	this->_scratch.resize(count);
+	for (u32 i = 0; i < count; i++)
+	{
+		this->_entries[i] = { this->_merged[i].Key, i };
+	}
+
+	// LSD radix sort, one byte per pass. Each pass is stable, so the whole sort is too
+	for (u32 shift = 0; shift < 64; shift += 8)
+	{
+		u32 offsets[256] = {};
+		for (const SortEntry& entry : this->_entries)
+		{
+			offsets[(entry.key >> shift) & 0xFF]++;
+		}
+
+		// Every key has the same byte here, so this pass would not move anything
+		if (offsets[(this->_entries[0].key >> shift) & 0xFF] == count)
+			continue;
+
+		u32 total = 0;
+		for (u32& offset : offsets)
+		{
+			const u32 bucket = offset;
+			offset           = total;
+			total += bucket;
+		}
+
+		for (const SortEntry& entry : this->_entries)
+		{
+			this->_scratch[offsets[(entry.key >> shift) & 0xFF]++] = entry;
+		}
+		this->_entries.swap(this->_scratch);
+	}
+}
+
+}
@@ -0,0 +1,106 @@
+#include <OtterML/RenderStats.hpp>
+
+#include <algorithm>
+#include <iterator>
+
+#include <glad/gl.h>
+
+namespace oter
+{
+
+namespace
+{
+
+struct StatsState
+{
+public:
+	u64 current[RENDER_COUNTER_COUNT]                          = {};
+	u64 history[RenderStats::WINDOW_SIZE][RENDER_COUNTER_COUNT] = {};
+	u32 next                                                    = 0;
+	u32 frameCount                                              = 0;
+};
+
+thread_local StatsState state;
+
+}
+
+const RenderStatRange& RenderStatsSnapshot::Get(const RenderCounter counter) const
+{
+	return this->Counters[static_cast<u32>(counter)];
+}
+
+void RenderStats::Add(const RenderCounter counter, const u64 amount)
+{
+	state.current[static_cast<u32>(counter)] += amount;
+}
+
+void RenderStats::AddDraw(const u32 mode, const u64 vertexCount, const u64 instanceCount)
+{
+	state.current[static_cast<u32>(RenderCounter::DrawCalls)]++;
+	state.current[static_cast<u32>(RenderCounter::Triangles)] += GetTriangleCount(mode, vertexCount) * instanceCount;
+}
+
+u64 RenderStats::GetTriangleCount(const u32 mode, const u64 vertexCount)
+{
+	switch (mode)
+	{
+	case GL_TRIANGLES:
+		return vertexCount / 3;
+	case GL_TRIANGLE_STRIP:
+	case GL_TRIANGLE_FAN:
+		return vertexCount > 2 ? vertexCount - 2 : 0;
+	default:
+		return 0;
+	}
+}
+
+void RenderStats::EndFrame()
+{
+	std::copy(std::begin(state.current), std::end(state.current), state.history[state.next]);
+	std::fill(std::begin(state.current), std::end(state.current), 0);
+
+	state.next       = (state.next + 1) % WINDOW_SIZE;
+	state.frameCount = std::min(state.frameCount + 1, WINDOW_SIZE);
+}
+
+u64 RenderStats::GetCurrent(const RenderCounter counter)
+{
+	return state.current[static_cast<u32>(counter)];
+}
+
+RenderStatsSnapshot RenderStats::GetSnapshot()
+{
+	RenderStatsSnapshot snapshot;
+	snapshot.FrameCount = state.frameCount;
+
+	if (state.frameCount == 0)
+		return snapshot;
+
+	const u32 last = (state.next + WINDOW_SIZE - 1) % WINDOW_SIZE;
+	for (u32 counter = 0; counter < RENDER_COUNTER_COUNT; counter++)
+	{
+		RenderStatRange& range = snapshot.Counters[counter];
+		range.Last             = state.history[last][counter];
+		range.Min              = UINT64_MAX;
+
+		// Until the window has filled, the frames recorded so far are the first frameCount slots
+		u64 sum = 0;
+		for (u32 frame = 0; frame < state.frameCount; frame++)
+		{
+			const u64 value = state.history[frame][counter];
+			range.Min       = std::min(range.Min, value);
+			range.Max       = std::max(range.Max, value);
+			sum += value;
+		}
+		range.Average = static_cast<f64>(sum) / static_cast<f64>(state.frameCount);
+	}
+
+	return snapshot;
+}
+
+void RenderStats::Reset()
+{
+	state = StatsState();
+}
+
+}
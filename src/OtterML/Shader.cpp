@@ -1,9 +1,13 @@
 #include <OtterML/Shader.hpp>
 
+#include <cstring>
 #include <iostream>
 
 #include <glad/gl.h>
+#include <OtterML/GLState.hpp>
 #include <OtterML/Common.hpp>
+#include <OtterML/Profiler.hpp>
+#include <OtterML/RenderStats.hpp>
 
 namespace oter
 {
@@ -16,13 +20,13 @@ Shader::~Shader()
 
 void Shader::Delete()
 {
-	glDeleteProgram(this->_id);
+	GLState::DeleteProgram(this->_id);
 	this->_id = 0;
 }
 
 void Shader::Use() const
 {
-	glUseProgram(this->_id);
+	GLState::UseProgram(this->_id);
 }
 
 void Shader::Compile(const std::string& vertSource, const std::string& fragSource)
@@ -37,6 +41,8 @@ void Shader::Compile(const std::string& vertSource, const std::string& geomSourc
 
 void Shader::Compile(const char* vertSource, const char* geomSource, const char* fragSource)
 {
+	OTTERML_PROFILE_ZONE("Shader::Compile");
+
 	// vertex
 	const u32 vert = glCreateShader(GL_VERTEX_SHADER);
 	glShaderSource(vert, 1, &vertSource, nullptr);
@@ -81,6 +87,7 @@ void Shader::SetFloat(const char* name, const f32 value, const bool useProgram)
 	if (useProgram)
 		this->Use();
 	glUniform1f(glGetUniformLocation(this->_id, name), value);
+	RenderStats::Add(RenderCounter::UniformCalls);
 }
 
 void Shader::SetVector2f(const char* name, const f32 x, const f32 y, const bool useProgram) const
@@ -88,6 +95,7 @@ void Shader::SetVector2f(const char* name, const f32 x, const f32 y, const bool
 	if (useProgram)
 		this->Use();
 	glUniform2f(glGetUniformLocation(this->_id, name), x, y);
+	RenderStats::Add(RenderCounter::UniformCalls);
 }
 
 void Shader::SetVector2f(const char* name, const Vector2<f32>& value, const bool useProgram) const
@@ -100,6 +108,7 @@ void Shader::SetVector3f(const char* name, const f32 x, const f32 y, const f32 z
 	if (useProgram)
 		this->Use();
 	glUniform3f(glGetUniformLocation(this->_id, name), x, y, z);
+	RenderStats::Add(RenderCounter::UniformCalls);
 }
 
 void Shader::SetVector3f(const char* name, const Vector3<f32>& value, const bool useProgram) const
@@ -114,6 +123,7 @@ void Shader::SetVector4f(const char* name, const f32 x, const f32 y, const f32 z
 	if (useProgram)
 		this->Use();
 	glUniform4f(glGetUniformLocation(this->_id, name), x, y, z, w);
+	RenderStats::Add(RenderCounter::UniformCalls);
 }
 
 void Shader::SetInt(const char* name, const i32 value, const bool useProgram) const
@@ -121,6 +131,7 @@ void Shader::SetInt(const char* name, const i32 value, const bool useProgram) co
 	if (useProgram)
 		this->Use();
 	glUniform1i(glGetUniformLocation(this->_id, name), value);
+	RenderStats::Add(RenderCounter::UniformCalls);
 }
 
 void Shader::SetVector2i(const char* name, const i32 x, const i32 y, const bool useProgram) const
@@ -128,6 +139,7 @@ void Shader::SetVector2i(const char* name, const i32 x, const i32 y, const bool
 	if (useProgram)
 		this->Use();
 	glUniform2i(glGetUniformLocation(this->_id, name), x, y);
+	RenderStats::Add(RenderCounter::UniformCalls);
 }
 
 void Shader::SetVector2i(const char* name, const Vector2<i32>& value, const bool useProgram) const
@@ -140,6 +152,7 @@ void Shader::SetVector3i(const char* name, const i32 x, const i32 y, const i32 z
 	if (useProgram)
 		this->Use();
 	glUniform3i(glGetUniformLocation(this->_id, name), x, y, z);
+	RenderStats::Add(RenderCounter::UniformCalls);
 }
 
 void Shader::SetVector3i(const char* name, const Vector3<i32>& value, const bool useProgram) const
@@ -153,6 +166,7 @@ void Shader::SetVector4i(const char* name, const i32 x, const i32 y, const i32 z
 	if (useProgram)
 		this->Use();
 	glUniform4i(glGetUniformLocation(this->_id, name), x, y, z, w);
+	RenderStats::Add(RenderCounter::UniformCalls);
 }
 
 void Shader::SetUInt(const char* name, const u32 value, const bool useProgram) const
@@ -160,6 +174,7 @@ void Shader::SetUInt(const char* name, const u32 value, const bool useProgram) c
 	if (useProgram)
 		this->Use();
 	glUniform1ui(glGetUniformLocation(this->_id, name), value);
+	RenderStats::Add(RenderCounter::UniformCalls);
 }
 
 void Shader::SetVector2u(const char* name, const u32 x, const u32 y, const bool useProgram) const
@@ -167,6 +182,7 @@ void Shader::SetVector2u(const char* name, const u32 x, const u32 y, const bool
 	if (useProgram)
 		this->Use();
 	glUniform2ui(glGetUniformLocation(this->_id, name), x, y);
+	RenderStats::Add(RenderCounter::UniformCalls);
 }
 
 void Shader::SetVector2u(const char* name, const Vector2<u32>& value, const bool useProgram) const
@@ -179,6 +195,7 @@ void Shader::SetVector3u(const char* name, const u32 x, const u32 y, const u32 z
 	if (useProgram)
 		this->Use();
 	glUniform3ui(glGetUniformLocation(this->_id, name), x, y, z);
+	RenderStats::Add(RenderCounter::UniformCalls);
 }
 
 void Shader::SetVector3u(const char* name, const Vector3<u32>& value, const bool useProgram) const
@@ -192,6 +209,7 @@ void Shader::SetVector4u(const char* name, const u32 x, const u32 y, const u32 z
 	if (useProgram)
 		this->Use();
 	glUniform4ui(glGetUniformLocation(this->_id, name), x, y, z, w);
+	RenderStats::Add(RenderCounter::UniformCalls);
 }
 
 void Shader::SetMatrix2(const char* name, const Matrix<f32, 2, 2>& matrix, bool useProgram) const
@@ -199,6 +217,7 @@ void Shader::SetMatrix2(const char* name, const Matrix<f32, 2, 2>& matrix, bool
 	if (useProgram)
 		this->Use();
 	glUniformMatrix2fv(glGetUniformLocation(this->_id, name), 1, true, matrix.GetData().data());
+	RenderStats::Add(RenderCounter::UniformCalls);
 }
 
 void Shader::SetMatrix3(const char* name, const Matrix<f32, 3, 3>& matrix, bool useProgram) const
@@ -206,6 +225,7 @@ void Shader::SetMatrix3(const char* name, const Matrix<f32, 3, 3>& matrix, bool
 	if (useProgram)
 		this->Use();
 	glUniformMatrix3fv(glGetUniformLocation(this->_id, name), 1, true, matrix.GetData().data());
+	RenderStats::Add(RenderCounter::UniformCalls);
 }
 
 void Shader::SetMatrix4(const char* name, const Matrix<f32, 4, 4>& matrix, bool useProgram) const
@@ -213,6 +233,7 @@ void Shader::SetMatrix4(const char* name, const Matrix<f32, 4, 4>& matrix, bool
 	if (useProgram)
 		this->Use();
 	glUniformMatrix4fv(glGetUniformLocation(this->_id, name), 1, true, matrix.GetData().data());
+	RenderStats::Add(RenderCounter::UniformCalls);
 }
 
 Shader::operator u32() const
@@ -0,0 +1,206 @@
+#include <OtterML/ShapeBatch.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include <glad/gl.h>
+#include <OtterML/Angle.hpp>
+#include <OtterML/GLState.hpp>
+#include <OtterML/Profiler.hpp>
+#include <OtterML/RenderStats.hpp>
+#include <OtterML/Shader.hpp>
+
+namespace oter
+{
+
+// Largest distance, in pixels, an automatically subdivided circle edge may stray from the true circle
+static constexpr f32 CIRCLE_TOLERANCE = 0.25f;
+
+static constexpr u32 MIN_CIRCLE_SEGMENTS = 8;
+static constexpr u32 MAX_CIRCLE_SEGMENTS = 256;
+
+const char* const ShapeBatch::FRAGMENT_SOURCE = R"(#version 330 core
+in vec4 vColor;
+
+out vec4 FragColor;
+
+void main()
+{
+	FragColor = vColor;
+}
+)";
+
+ShapeBatch::ShapeBatch() {}
+
+ShapeBatch::~ShapeBatch() {}
+
+void ShapeBatch::Init()
+{
+	// Room for a few thousand shapes per region before the stream buffers have to move on or grow
+	constexpr u32 regionSize = 8192 * sizeof(Vertex2D);
+
+	for (Layer* layer : { &this->_triangles, &this->_lines })
+	{
+		glGenVertexArrays(1, &layer->vao);
+		layer->stream.Init(GL_ARRAY_BUFFER, regionSize);
+	}
+}
+
+void ShapeBatch::Delete()
+{
+	for (Layer* layer : { &this->_triangles, &this->_lines })
+	{
+		layer->stream.Delete();
+		GLState::DeleteVertexArrays(1, &layer->vao);
+		layer->vao = 0;
+	}
+}
+
+void ShapeBatch::Begin()
+{
+	this->_triangles.vertices.clear();
+	this->_lines.vertices.clear();
+}
+
+void ShapeBatch::Line(const Vector2<f32>& from, const Vector2<f32>& to, const Color& color)
+{
+	this->AddVertex(this->_lines, from, color);
+	this->AddVertex(this->_lines, to, color);
+}
+
+void ShapeBatch::Rect(const Vector2<f32>& position, const Vector2<f32>& size, const Color& color, const bool filled)
+{
+	const Vector2<f32> corners[4] = {
+		position,
+		Vector2<f32>(position.X + size.X, position.Y),
+		Vector2<f32>(position.X + size.X, position.Y + size.Y),
+		Vector2<f32>(position.X, position.Y + size.Y),
+	};
+	this->Polygon(corners, color, filled);
+}
+
+void ShapeBatch::Circle(const Vector2<f32>& center, const f32 radius, const Color& color, const bool filled, u32 segments)
+{
+	if (radius <= 0.f)
+		return;
+
+	constexpr f32 tau = static_cast<f32>(2.0 * PI);
+
+	if (segments == 0)
+	{
+		// An edge spanning angle a strays r * (1 - cos(a / 2)) from the circle
+		const f32 step = radius > CIRCLE_TOLERANCE ? 2.f * std::acos(1.f - CIRCLE_TOLERANCE / radius) : tau;
+		segments       = static_cast<u32>(std::ceil(tau / step));
+	}
+	segments = std::clamp(segments, MIN_CIRCLE_SEGMENTS, MAX_CIRCLE_SEGMENTS);
+
+	// Rotating the previous point by a fixed step is enough for a few hundred segments
+	const f32 cosine = std::cos(tau / static_cast<f32>(segments));
+	const f32 sine   = std::sin(tau / static_cast<f32>(segments));
+
+	Vector2<f32> offset = Vector2<f32>(radius, 0.f);
+	Vector2<f32> point  = center + offset;
+	for (u32 i = 0; i < segments; i++)
+	{
+		offset = Vector2<f32>(offset.X * cosine - offset.Y * sine, offset.X * sine + offset.Y * cosine);
+
+		// The last edge ends exactly where the first began, so the outline closes without a gap
+		const Vector2<f32> next = i + 1 == segments ? center + Vector2<f32>(radius, 0.f) : center + offset;
+
+		if (filled)
+		{
+			this->AddVertex(this->_triangles, center, color);
+			this->AddVertex(this->_triangles, point, color);
+			this->AddVertex(this->_triangles, next, color);
+		}
+		else
+		{
+			this->Line(point, next, color);
+		}
+		point = next;
+	}
+}
+
+void ShapeBatch::Polygon(const std::span<const Vector2<f32>> points, const Color& color, const bool filled)
+{
+	if (points.size() < 2)
+		return;
+
+	if (!filled)
+	{
+		for (size_t i = 0; i < points.size(); i++)
+		{
+			this->Line(points[i], points[(i + 1) % points.size()], color);
+		}
+		return;
+	}
+
+	for (size_t i = 1; i + 1 < points.size(); i++)
+	{
+		this->AddVertex(this->_triangles, points[0], color);
+		this->AddVertex(this->_triangles, points[i], color);
+		this->AddVertex(this->_triangles, points[i + 1], color);
+	}
+}
+
+void ShapeBatch::End(const Shader& shader)
+{
+	OTTERML_PROFILE_ZONE("ShapeBatch::End");
+
+	this->_drawCallCount = 0;
+	this->_lineCount     = static_cast<u32>(this->_lines.vertices.size() / 2);
+	this->_triangleCount = static_cast<u32>(this->_triangles.vertices.size() / 3);
+
+	if (this->_lines.vertices.empty() && this->_triangles.vertices.empty())
+		return;
+
+	shader.Use();
+	this->_drawCallCount += this->Flush(this->_triangles, GL_TRIANGLES);
+	this->_drawCallCount += this->Flush(this->_lines, GL_LINES);
+
+	GLState::BindVertexArray(0);
+}
+
+u32 ShapeBatch::GetDrawCallCount() const
+{
+	return this->_drawCallCount;
+}
+
+u32 ShapeBatch::GetLineCount() const
+{
+	return this->_lineCount;
+}
+
+u32 ShapeBatch::GetTriangleCount() const
+{
+	return this->_triangleCount;
+}
+
+void ShapeBatch::AddVertex(Layer& layer, const Vector2<f32>& position, const Color& color)
+{
+	Vertex2D vertex;
+	vertex.X    = position.X;
+	vertex.Y    = position.Y;
+	vertex.Tint = color;
+	layer.vertices.push_back(vertex);
+}
+
+bool ShapeBatch::Flush(Layer& layer, const u32 mode)
+{
+	if (layer.vertices.empty())
+		return false;
+
+	const u32 vertexCount = static_cast<u32>(layer.vertices.size());
+	const u32 offset      = layer.stream.Write(layer.vertices.data(), vertexCount * sizeof(Vertex2D), sizeof(Vertex2D));
+
+	// The stream buffer may have been replaced while growing, so point the attributes at it every time
+	GLState::BindVertexArray(layer.vao);
+	GLState::BindBuffer(GL_ARRAY_BUFFER, layer.stream.GetID());
+	Vertex2D::SetAttributes();
+
+	glDrawArrays(mode, static_cast<i32>(offset / sizeof(Vertex2D)), static_cast<i32>(vertexCount));
+	RenderStats::AddDraw(mode, vertexCount);
+	return true;
+}
+
+}
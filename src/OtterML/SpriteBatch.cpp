@@ -0,0 +1,255 @@
+#include <OtterML/SpriteBatch.hpp>
+
+#include <algorithm>
+
+#include <glad/gl.h>
+#include <OtterML/GLState.hpp>
+#include <OtterML/Profiler.hpp>
+#include <OtterML/RenderStats.hpp>
+#include <OtterML/Shader.hpp>
+#include <OtterML/Texture2D.hpp>
+
+namespace oter
+{
+
+const char* const SpriteBatch::VERTEX_SOURCE = R"(#version 330 core
+layout (location = 0) in vec2 aPosition;
+layout (location = 1) in vec2 aTexCoord;
+layout (location = 2) in vec4 aColor;
+
+uniform mat3 uProjection;
+
+out vec2 vTexCoord;
+out vec4 vColor;
+
+void main()
+{
+	gl_Position = vec4((uProjection * vec3(aPosition, 1.0)).xy, 0.0, 1.0);
+	vTexCoord   = aTexCoord;
+	vColor      = aColor;
+}
+)";
+
+const char* const SpriteBatch::FRAGMENT_SOURCE = R"(#version 330 core
+in vec2 vTexCoord;
+in vec4 vColor;
+
+uniform sampler2D uTexture;
+
+out vec4 FragColor;
+
+void main()
+{
+	FragColor = texture(uTexture, vTexCoord) * vColor;
+}
+)";
+
+SpriteBatch::SpriteBatch() {}
+
+SpriteBatch::~SpriteBatch() {}
+
+void SpriteBatch::Init()
+{
+	// Room for a few thousand sprites per region before the stream buffer has to move on or grow
+	constexpr u32 regionSize = 4096 * 4 * sizeof(Vertex2D);
+
+	glGenVertexArrays(1, &this->_vao);
+	glGenBuffers(1, &this->_ibo);
+	this->_vertexStream.Init(GL_ARRAY_BUFFER, regionSize);
+
+	// The element buffer binding is part of the VAO state
+	GLState::BindVertexArray(this->_vao);
+	GLState::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->_ibo);
+	GLState::BindVertexArray(0);
+}
+
+void SpriteBatch::Delete()
+{
+	this->_vertexStream.Delete();
+	GLState::DeleteBuffers(1, &this->_ibo);
+	GLState::DeleteVertexArrays(1, &this->_vao);
+
+	this->_vao         = 0;
+	this->_ibo         = 0;
+	this->_iboCapacity = 0;
+}
+
+void SpriteBatch::Begin(const SpriteSortMode sortMode)
+{
+	this->_sortMode = sortMode;
+	this->_sprites.clear();
+	this->_vertices.clear();
+}
+
+void SpriteBatch::Draw(const Texture2D& texture, const Shader& shader, const Matrix<f32, 3, 3>& transform,
+                       const Vector2<f32>& size, const Vector2<f32>& uvPosition, const Vector2<f32>& uvSize,
+                       const Color& color)
+{
+	const std::array<f32, 9>& m = transform.GetData();
+
+	const Sprite sprite = {
+		&texture,
+		&shader,
+		static_cast<u64>(shader.GetID()) << 32 | texture.GetID(),
+		static_cast<u32>(this->_vertices.size()),
+		1,
+	};
+	this->_sprites.push_back(sprite);
+
+	const f32 corners[4][2] = { { 0.f, 0.f }, { size.X, 0.f }, { 0.f, size.Y }, { size.X, size.Y } };
+	const f32 uvs[4][2]     = {
+		{ uvPosition.X, uvPosition.Y },
+		{ uvPosition.X + uvSize.X, uvPosition.Y },
+		{ uvPosition.X, uvPosition.Y + uvSize.Y },
+		{ uvPosition.X + uvSize.X, uvPosition.Y + uvSize.Y },
+	};
+
+	for (u32 i = 0; i < 4; i++)
+	{
+		Vertex2D vertex;
+		vertex.X    = m[0] * corners[i][0] + m[1] * corners[i][1] + m[2];
+		vertex.Y    = m[3] * corners[i][0] + m[4] * corners[i][1] + m[5];
+		vertex.U    = uvs[i][0];
+		vertex.V    = uvs[i][1];
+		vertex.Tint = color;
+		this->_vertices.push_back(vertex);
+	}
+}
+
+void SpriteBatch::Draw(const Texture2D& texture, const Shader& shader, const Matrix<f32, 3, 3>& transform,
+                       const Vector2<u32>& framePosition, const Color& color)
+{
+	const Vector2<f32> textureSize = Vector2<f32>(texture.GetTextureSize());
+	const Vector2<f32> frameSize   = Vector2<f32>(texture.GetFrameSize());
+
+	this->Draw(
+		texture, shader, transform, frameSize,
+		Vector2<f32>(framePosition) / textureSize,
+		frameSize / textureSize,
+		color
+	);
+}
+
+void SpriteBatch::Draw(const Texture2D& texture, const Shader& shader, const std::span<const Vertex2D> quads)
+{
+	if (quads.size() < 4)
+		return;
+
+	const Sprite sprite = {
+		&texture,
+		&shader,
+		static_cast<u64>(shader.GetID()) << 32 | texture.GetID(),
+		static_cast<u32>(this->_vertices.size()),
+		static_cast<u32>(quads.size() / 4),
+	};
+	this->_sprites.push_back(sprite);
+
+	this->_vertices.insert(this->_vertices.end(), quads.begin(), quads.begin() + sprite.quadCount * 4);
+}
+
+void SpriteBatch::End()
+{
+	OTTERML_PROFILE_ZONE("SpriteBatch::End");
+
+	this->_batchCount  = 0;
+	this->_spriteCount = static_cast<u32>(this->_sprites.size());
+
+	if (this->_sprites.empty())
+		return;
+
+	// Stable, so sprites sharing a shader and texture keep their submission order
+	const std::vector<Vertex2D>* vertices = &this->_vertices;
+	if (this->_sortMode == SpriteSortMode::ShaderTexture)
+	{
+		std::stable_sort(this->_sprites.begin(), this->_sprites.end(), [](const Sprite& left, const Sprite& right)
+		{
+			return left.key < right.key;
+		});
+
+		this->_sortedVertices.resize(this->_vertices.size());
+		auto output = this->_sortedVertices.begin();
+		for (const Sprite& sprite : this->_sprites)
+		{
+			output = std::copy_n(this->_vertices.begin() + sprite.firstVertex, sprite.quadCount * 4, output);
+		}
+		vertices = &this->_sortedVertices;
+	}
+
+	const u32 quadCount = static_cast<u32>(vertices->size() / 4);
+
+	GLState::BindVertexArray(this->_vao);
+	const u32 baseVertex = this->Upload(*vertices, quadCount);
+
+	// Sprites now lie in the uploaded order, so a run of equal keys is a contiguous range of quads
+	u32 runStart     = 0;
+	u32 runFirstQuad = 0;
+	u32 runQuads     = 0;
+	for (u32 i = 0; i <= this->_spriteCount; i++)
+	{
+		if (i < this->_spriteCount && this->_sprites[i].key == this->_sprites[runStart].key)
+		{
+			runQuads += this->_sprites[i].quadCount;
+			continue;
+		}
+
+		const Sprite& sprite = this->_sprites[runStart];
+		sprite.shader->Use();
+		GLState::ActiveTexture(0);
+		sprite.texture->Bind();
+
+		glDrawElementsBaseVertex(GL_TRIANGLES, static_cast<i32>(runQuads * 6), GL_UNSIGNED_INT,
+		                         reinterpret_cast<void*>(static_cast<size_t>(runFirstQuad) * 6 * sizeof(u32)),
+		                         static_cast<i32>(baseVertex));
+		RenderStats::AddDraw(GL_TRIANGLES, static_cast<u64>(runQuads) * 6);
+
+		this->_batchCount++;
+		runStart      = i;
+		runFirstQuad += runQuads;
+		runQuads      = i < this->_spriteCount ? this->_sprites[i].quadCount : 0;
+	}
+
+	GLState::BindVertexArray(0);
+}
+
+u32 SpriteBatch::GetBatchCount() const
+{
+	return this->_batchCount;
+}
+
+u32 SpriteBatch::GetSpriteCount() const
+{
+	return this->_spriteCount;
+}
+
+u32 SpriteBatch::Upload(const std::vector<Vertex2D>& vertices, const u32 quadCount)
+{
+	const u32 vertexBytes = static_cast<u32>(vertices.size() * sizeof(Vertex2D));
+	const u32 offset      = this->_vertexStream.Write(vertices.data(), vertexBytes, sizeof(Vertex2D));
+
+	// The stream buffer may have been replaced while growing, so point the attributes at it every time
+	GLState::BindBuffer(GL_ARRAY_BUFFER, this->_vertexStream.GetID());
+	Vertex2D::SetAttributes();
+
+	// Quad indices never change, so the element buffer only grows
+	if (quadCount > this->_iboCapacity)
+	{
+		this->_iboCapacity = std::max(quadCount, this->_iboCapacity * 2);
+
+		std::vector<u32> indices(static_cast<size_t>(this->_iboCapacity) * 6);
+		for (u32 i = 0; i < this->_iboCapacity; i++)
+		{
+			indices[i * 6 + 0] = i * 4 + 0;
+			indices[i * 6 + 1] = i * 4 + 1;
+			indices[i * 6 + 2] = i * 4 + 2;
+			indices[i * 6 + 3] = i * 4 + 2;
+			indices[i * 6 + 4] = i * 4 + 1;
+			indices[i * 6 + 5] = i * 4 + 3;
+		}
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indices.size() * sizeof(u32)), indices.data(), GL_STATIC_DRAW);
+		RenderStats::Add(RenderCounter::BufferBytesUploaded, indices.size() * sizeof(u32));
+	}
+
+	return offset / sizeof(Vertex2D);
+}
+
+}
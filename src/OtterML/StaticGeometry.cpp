@@ -0,0 +1,182 @@
+#include <OtterML/StaticGeometry.hpp>
+
+#include <stdexcept>
+
+#include <OtterML/GLExtensions.hpp>
+#include <OtterML/GLState.hpp>
+#include <OtterML/Profiler.hpp>
+#include <OtterML/RenderStats.hpp>
+#include <OtterML/Shader.hpp>
+#include <OtterML/Texture2D.hpp>
+
+namespace oter
+{
+
+StaticGeometry::StaticGeometry() {}
+
+StaticGeometry::~StaticGeometry() {}
+
+void StaticGeometry::Init()
+{
+	glGenVertexArrays(1, &this->_vao);
+	glGenBuffers(1, &this->_vbo);
+	glGenBuffers(1, &this->_ibo);
+	glGenBuffers(1, &this->_indirect);
+
+	GLState::BindVertexArray(this->_vao);
+	GLState::BindBuffer(GL_ARRAY_BUFFER, this->_vbo);
+	Vertex2D::SetAttributes();
+	GLState::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->_ibo);
+	GLState::BindVertexArray(0);
+}
+
+void StaticGeometry::Delete()
+{
+	const u32 buffers[3] = { this->_vbo, this->_ibo, this->_indirect };
+	GLState::DeleteBuffers(3, buffers);
+	GLState::DeleteVertexArrays(1, &this->_vao);
+
+	this->_vao      = 0;
+	this->_vbo      = 0;
+	this->_ibo      = 0;
+	this->_indirect = 0;
+	this->_uploaded = false;
+}
+
+StaticGeometry::Mesh StaticGeometry::Add(const std::span<const Vertex2D> vertices, const std::span<const u32> indices)
+{
+	const DrawCommand command = {
+		static_cast<u32>(indices.size()),
+		1,
+		static_cast<u32>(this->_indices.size()),
+		static_cast<i32>(this->_vertices.size()),
+		0,
+	};
+	this->_commands.push_back(command);
+	this->_triangleCount += command.count / 3;
+
+	this->_vertices.insert(this->_vertices.end(), vertices.begin(), vertices.end());
+	this->_indices.insert(this->_indices.end(), indices.begin(), indices.end());
+	this->_uploaded = false;
+
+	return static_cast<Mesh>(this->_commands.size() - 1);
+}
+
+void StaticGeometry::Clear()
+{
+	this->_vertices.clear();
+	this->_indices.clear();
+	this->_commands.clear();
+	this->_uploaded      = false;
+	this->_triangleCount = 0;
+}
+
+void StaticGeometry::SetVisible(const Mesh mesh, const bool visible)
+{
+	if (mesh >= this->_commands.size())
+		throw std::out_of_range("StaticGeometry mesh does not exist.");
+
+	DrawCommand& command = this->_commands[mesh];
+	if ((command.instanceCount != 0) == visible)
+		return;
+
+	// A hidden mesh stays in the buffers and is simply drawn zero times
+	command.instanceCount = visible ? 1 : 0;
+	if (visible)
+		this->_triangleCount += command.count / 3;
+	else
+		this->_triangleCount -= command.count / 3;
+	if (this->_uploaded)
+	{
+		GLState::BindBuffer(GL_DRAW_INDIRECT_BUFFER, this->_indirect);
+		glBufferSubData(GL_DRAW_INDIRECT_BUFFER,
+		                static_cast<GLintptr>(mesh * sizeof(DrawCommand) + offsetof(DrawCommand, instanceCount)),
+		                sizeof(u32), &command.instanceCount);
+		RenderStats::Add(RenderCounter::BufferBytesUploaded, sizeof(u32));
+	}
+}
+
+bool StaticGeometry::IsVisible(const Mesh mesh) const
+{
+	if (mesh >= this->_commands.size())
+		throw std::out_of_range("StaticGeometry mesh does not exist.");
+
+	return this->_commands[mesh].instanceCount != 0;
+}
+
+u32 StaticGeometry::GetMeshCount() const
+{
+	return static_cast<u32>(this->_commands.size());
+}
+
+void StaticGeometry::Draw(const Texture2D& texture, const Shader& shader)
+{
+	OTTERML_PROFILE_ZONE("StaticGeometry::Draw");
+
+	this->_drawCallCount = 0;
+
+	if (this->_commands.empty())
+		return;
+
+	if (!this->_uploaded)
+		this->Upload();
+
+	GLState::BindVertexArray(this->_vao);
+	GLState::BindBuffer(GL_DRAW_INDIRECT_BUFFER, this->_indirect);
+
+	shader.Use();
+	GLState::ActiveTexture(0);
+	texture.Bind();
+
+	if (GLExtensions.MultiDrawElementsIndirect != nullptr)
+	{
+		GLExtensions.MultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr,
+		                                       static_cast<i32>(this->_commands.size()), sizeof(DrawCommand));
+		this->_drawCallCount = 1;
+
+		RenderStats::Add(RenderCounter::DrawCalls);
+		RenderStats::Add(RenderCounter::Triangles, this->_triangleCount);
+	}
+	else
+	{
+		for (size_t i = 0; i < this->_commands.size(); i++)
+		{
+			glDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, reinterpret_cast<void*>(i * sizeof(DrawCommand)));
+			RenderStats::AddDraw(GL_TRIANGLES, this->_commands[i].count, this->_commands[i].instanceCount);
+		}
+		this->_drawCallCount = static_cast<u32>(this->_commands.size());
+	}
+
+	GLState::BindVertexArray(0);
+}
+
+u32 StaticGeometry::GetDrawCallCount() const
+{
+	return this->_drawCallCount;
+}
+
+void StaticGeometry::Upload()
+{
+	GLState::BindVertexArray(this->_vao);
+
+	GLState::BindBuffer(GL_ARRAY_BUFFER, this->_vbo);
+	glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(this->_vertices.size() * sizeof(Vertex2D)),
+	             this->_vertices.data(), GL_STATIC_DRAW);
+
+	GLState::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->_ibo);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(this->_indices.size() * sizeof(u32)),
+	             this->_indices.data(), GL_STATIC_DRAW);
+
+	GLState::BindBuffer(GL_DRAW_INDIRECT_BUFFER, this->_indirect);
+	glBufferData(GL_DRAW_INDIRECT_BUFFER, static_cast<GLsizeiptr>(this->_commands.size() * sizeof(DrawCommand)),
+	             this->_commands.data(), GL_STATIC_DRAW);
+
+	const u64 bytes = this->_vertices.size() * sizeof(Vertex2D) + this->_indices.size() * sizeof(u32)
+	                + this->_commands.size() * sizeof(DrawCommand);
+	RenderStats::Add(RenderCounter::BufferBytesUploaded, bytes);
+
+	GLState::BindVertexArray(0);
+	this->_uploaded = true;
+}
+
+}
@@ -0,0 +1,193 @@
+#include <OtterML/StreamBuffer.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#include <OtterML/GLExtensions.hpp>
+#include <OtterML/GLState.hpp>
+#include <OtterML/RenderStats.hpp>
+
+namespace oter
+{
+
+StreamBuffer::StreamBuffer() {}
+
+StreamBuffer::~StreamBuffer() {}
+
+void StreamBuffer::Init(const u32 target, const u32 regionSize, const u32 regionCount, const bool allowPersistent)
+{
+	this->_target      = target;
+	this->_regionSize  = regionSize;
+	this->_regionCount = std::max(regionCount, 1u);
+	this->_persistent  = allowPersistent && GLExtensions.BufferStorage != nullptr;
+
+	this->Create();
+}
+
+void StreamBuffer::Delete()
+{
+	this->Destroy();
+	this->_regionSize  = 0;
+	this->_regionCount = 0;
+}
+
+void* StreamBuffer::Map(const u32 size, const u32 alignment, u32& offset)
+{
+	u32 aligned = (this->_offset + alignment - 1) / alignment * alignment;
+
+	if (aligned + size > this->_regionSize)
+	{
+		if (size > this->_regionSize)
+		{
+			// Everything already written has been submitted, so the old storage can simply be replaced
+			this->Destroy();
+			this->_regionSize = std::max(size, this->_regionSize * 2);
+			this->Create();
+		}
+		else
+		{
+			this->NextRegion();
+		}
+		aligned = 0;
+	}
+
+	const u32 regionStart = this->_region * this->_regionSize;
+	offset                = regionStart + aligned;
+	this->_offset         = aligned + size;
+
+	RenderStats::Add(RenderCounter::BufferBytesUploaded, size);
+
+	if (this->_persistent)
+		return this->_memory + offset;
+
+	// The storage was orphaned when this pass over the buffer started, so nothing in flight can be overwritten
+	GLState::BindBuffer(this->_target, this->_id);
+	this->_mapped = true;
+	return glMapBufferRange(this->_target, offset, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+}
+
+void StreamBuffer::Unmap()
+{
+	if (!this->_mapped)
+		return;
+
+	GLState::BindBuffer(this->_target, this->_id);
+	glUnmapBuffer(this->_target);
+	this->_mapped = false;
+}
+
+u32 StreamBuffer::Write(const void* data, const u32 size, const u32 alignment)
+{
+	u32   offset;
+	void* destination = this->Map(size, alignment, offset);
+	memcpy(destination, data, size);
+	this->Unmap();
+	return offset;
+}
+
+void StreamBuffer::EndFrame()
+{
+	if (this->_offset != 0)
+		this->NextRegion();
+}
+
+u32 StreamBuffer::GetID() const
+{
+	return this->_id;
+}
+
+bool StreamBuffer::IsPersistent() const
+{
+	return this->_persistent;
+}
+
+void StreamBuffer::Create()
+{
+	const u32 totalSize = this->_regionSize * this->_regionCount;
+
+	glGenBuffers(1, &this->_id);
+	GLState::BindBuffer(this->_target, this->_id);
+
+	if (this->_persistent)
+	{
+		constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		GLExtensions.BufferStorage(this->_target, totalSize, nullptr, flags);
+		this->_memory = static_cast<u8*>(glMapBufferRange(this->_target, 0, totalSize, flags));
+	}
+	else
+	{
+		glBufferData(this->_target, totalSize, nullptr, GL_STREAM_DRAW);
+	}
+
+	this->_fences.assign(this->_regionCount, nullptr);
+	this->_region = 0;
+	this->_offset = 0;
+}
+
+void StreamBuffer::Destroy()
+{
+	if (this->_id == 0)
+		return;
+
+	for (void*& fence : this->_fences)
+	{
+		if (fence != nullptr)
+			glDeleteSync(static_cast<GLsync>(fence));
+		fence = nullptr;
+	}
+
+	if (this->_persistent && this->_memory != nullptr)
+	{
+		GLState::BindBuffer(this->_target, this->_id);
+		glUnmapBuffer(this->_target);
+	}
+
+	GLState::DeleteBuffers(1, &this->_id);
+	this->_id     = 0;
+	this->_memory = nullptr;
+	this->_mapped = false;
+}
+
+void StreamBuffer::NextRegion()
+{
+	if (this->_persistent)
+	{
+		this->_fences[this->_region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+
+	this->_region = (this->_region + 1) % this->_regionCount;
+	this->_offset = 0;
+
+	if (this->_persistent)
+	{
+		this->WaitForRegion(this->_region);
+	}
+	else if (this->_region == 0)
+	{
+		// Wrapped around: orphan the storage instead of waiting for the GPU to finish with it
+		GLState::BindBuffer(this->_target, this->_id);
+		glBufferData(this->_target, this->_regionSize * this->_regionCount, nullptr, GL_STREAM_DRAW);
+	}
+}
+
+void StreamBuffer::WaitForRegion(const u32 region)
+{
+	GLsync fence = static_cast<GLsync>(this->_fences[region]);
+	if (fence == nullptr)
+		return;
+
+	// Flush on the first wait so the fence is guaranteed to signal eventually
+	GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+	while (true)
+	{
+		const GLenum result = glClientWaitSync(fence, flags, 1000000);
+		if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED || result == GL_WAIT_FAILED)
+			break;
+		flags = 0;
+	}
+
+	glDeleteSync(fence);
+	this->_fences[region] = nullptr;
+}
+
+}
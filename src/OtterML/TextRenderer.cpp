@@ -0,0 +1,245 @@
+#include <OtterML/TextRenderer.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include <OtterML/Font.hpp>
+#include <OtterML/GlyphAtlas.hpp>
+#include <OtterML/Profiler.hpp>
+#include <OtterML/SpriteBatch.hpp>
+
+namespace oter
+{
+
+static constexpr u32 REPLACEMENT_CHARACTER = 0xFFFD;
+
+static u64 HashRun(const Font& font, const std::string_view text, const u32 pixelHeight)
+{
+	// FNV-1a over the text, then the font and size
+	u64 hash = 0xCBF29CE484222325ull;
+	for (const char character : text)
+	{
+		hash = (hash ^ static_cast<u8>(character)) * 0x100000001B3ull;
+	}
+	hash = (hash ^ reinterpret_cast<uintptr_t>(&font)) * 0x100000001B3ull;
+	hash = (hash ^ pixelHeight) * 0x100000001B3ull;
+	return hash;
+}
+
+static u32 DecodeUtf8(const std::string_view text, size_t& index)
+{
+	const u8 lead = static_cast<u8>(text[index++]);
+	if (lead < 0x80)
+		return lead;
+
+	u32 length    = 0;
+	u32 codepoint = 0;
+	if ((lead & 0xE0) == 0xC0)
+	{
+		length    = 1;
+		codepoint = lead & 0x1F;
+	}
+	else if ((lead & 0xF0) == 0xE0)
+	{
+		length    = 2;
+		codepoint = lead & 0x0F;
+	}
+	else if ((lead & 0xF8) == 0xF0)
+	{
+		length    = 3;
+		codepoint = lead & 0x07;
+	}
+	else
+	{
+		return REPLACEMENT_CHARACTER;
+	}
+
+	for (u32 i = 0; i < length; i++)
+	{
+		if (index >= text.size() || (static_cast<u8>(text[index]) & 0xC0) != 0x80)
+			return REPLACEMENT_CHARACTER;
+
+		codepoint = codepoint << 6 | (static_cast<u8>(text[index++]) & 0x3F);
+	}
+	return codepoint;
+}
+
+static bool SameColor(const Color& left, const Color& right)
+{
+	return left.Red == right.Red && left.Green == right.Green && left.Blue == right.Blue && left.Alpha == right.Alpha;
+}
+
+TextRenderer::TextRenderer() {}
+
+TextRenderer::~TextRenderer() {}
+
+void TextRenderer::Init(GlyphAtlas& atlas)
+{
+	this->_atlas = &atlas;
+	this->Clear();
+}
+
+void TextRenderer::Draw(SpriteBatch& batch, const Shader& shader, const Font& font, const std::string_view text,
+                        const u32 pixelHeight, const Vector2<f32>& position, const Color& color)
+{
+	Run& run = this->GetRun(font, text, pixelHeight);
+	if (run.quads.empty())
+		return;
+
+	if (!run.placedValid || !(run.placedPosition == position) || !SameColor(run.placedColor, color))
+	{
+		run.placed.resize(run.quads.size());
+		for (size_t i = 0; i < run.quads.size(); i++)
+		{
+			Vertex2D& vertex = run.placed[i];
+			vertex           = run.quads[i];
+			vertex.X        += position.X;
+			vertex.Y        += position.Y;
+			vertex.Tint      = color;
+		}
+		run.placedPosition = position;
+		run.placedColor    = color;
+		run.placedValid    = true;
+	}
+
+	batch.Draw(this->_atlas->GetTexture(), shader, run.placed);
+}
+
+Vector2<f32> TextRenderer::Measure(const Font& font, const std::string_view text, const u32 pixelHeight)
+{
+	return this->GetRun(font, text, pixelHeight).size;
+}
+
+void TextRenderer::EndFrame()
+{
+	if (this->_atlas != nullptr)
+		this->_atlas->EndFrame();
+
+	std::erase_if(this->_runs, [](const auto& entry)
+	{
+		return !entry.second.used;
+	});
+
+	for (auto& [hash, run] : this->_runs)
+	{
+		run.used = false;
+	}
+	this->_layoutCount = 0;
+}
+
+void TextRenderer::Clear()
+{
+	this->_runs.clear();
+	this->_layoutCount = 0;
+}
+
+u32 TextRenderer::GetCachedRunCount() const
+{
+	return static_cast<u32>(this->_runs.size());
+}
+
+u32 TextRenderer::GetLayoutCount() const
+{
+	return this->_layoutCount;
+}
+
+TextRenderer::Run& TextRenderer::GetRun(const Font& font, const std::string_view text, const u32 pixelHeight)
+{
+	if (this->_atlas == nullptr)
+		throw std::logic_error("TextRenderer used before Init().");
+
+	Run& run = this->_runs[HashRun(font, text, pixelHeight)];
+
+	// A hash collision takes over the entry, since the old run is then unlikely to be drawn again soon
+	const bool same = run.font == &font && run.pixelHeight == pixelHeight && run.text == text;
+	if (!same || run.generation != this->_atlas->GetGeneration())
+	{
+		if (!same)
+		{
+			run.text        = text;
+			run.font        = &font;
+			run.pixelHeight = pixelHeight;
+		}
+		this->Layout(run);
+	}
+
+	run.used = true;
+	return run;
+}
+
+void TextRenderer::Layout(Run& run)
+{
+	OTTERML_PROFILE_ZONE("TextRenderer::Layout");
+
+	const Font& font       = *run.font;
+	const f32   scale      = font.GetScale(static_cast<f32>(run.pixelHeight));
+	const f32   lineHeight = static_cast<f32>(font.GetAscender() - font.GetDescender() + font.GetLineGap()) * scale;
+	const f32   baseline   = std::round(static_cast<f32>(font.GetAscender()) * scale);
+
+	run.generation = this->_atlas->GetGeneration();
+	run.quads.clear();
+
+	f32  penX     = 0.f;
+	f32  penY     = baseline;
+	f32  width    = 0.f;
+	u32  previous = 0;
+	bool hasGlyph = false;
+	for (size_t i = 0; i < run.text.size();)
+	{
+		const u32 codepoint = DecodeUtf8(run.text, i);
+		if (codepoint == '\n')
+		{
+			penX     = 0.f;
+			penY     = std::round(penY + lineHeight);
+			hasGlyph = false;
+			continue;
+		}
+
+		const u32 glyph = font.GetGlyphIndex(codepoint);
+		if (hasGlyph)
+			penX += static_cast<f32>(font.GetKerning(previous, glyph)) * scale;
+
+		// Glyphs left out of a full atlas have no size; the run is laid out again once EndFrame() empties it
+		const AtlasGlyph& placed = this->_atlas->GetGlyph(font, glyph, run.pixelHeight);
+		if (placed.Size.X > 0.f && placed.Size.Y > 0.f)
+		{
+			// Glyphs start on whole pixels, so they map texel for texel onto the screen
+			const f32 left  = std::round(penX) + placed.Offset.X;
+			const f32 top   = penY + placed.Offset.Y;
+			const f32 xs[4] = { left, left + placed.Size.X, left, left + placed.Size.X };
+			const f32 ys[4] = { top, top, top + placed.Size.Y, top + placed.Size.Y };
+			const f32 us[4] = {
+				placed.UVPosition.X, placed.UVPosition.X + placed.UVSize.X,
+				placed.UVPosition.X, placed.UVPosition.X + placed.UVSize.X,
+			};
+			const f32 vs[4] = {
+				placed.UVPosition.Y, placed.UVPosition.Y,
+				placed.UVPosition.Y + placed.UVSize.Y, placed.UVPosition.Y + placed.UVSize.Y,
+			};
+
+			for (u32 corner = 0; corner < 4; corner++)
+			{
+				Vertex2D vertex;
+				vertex.X    = xs[corner];
+				vertex.Y    = ys[corner];
+				vertex.U    = us[corner];
+				vertex.V    = vs[corner];
+				vertex.Tint = Color(0xFF, 0xFF, 0xFF);
+				run.quads.push_back(vertex);
+			}
+		}
+
+		penX     += static_cast<f32>(font.GetAdvance(glyph)) * scale;
+		width     = std::max(width, penX);
+		previous  = glyph;
+		hasGlyph  = true;
+	}
+
+	run.size = Vector2<f32>(std::ceil(width), penY - baseline + std::ceil(lineHeight));
+
+	run.placedValid = false;
+	this->_layoutCount++;
+}
+
+}
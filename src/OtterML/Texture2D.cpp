@@ -1,6 +1,9 @@
 #include <OtterML/Texture2D.hpp>
 
 #include <glad/gl.h>
+#include <OtterML/GLState.hpp>
+#include <OtterML/Profiler.hpp>
+#include <OtterML/RenderStats.hpp>
 
 namespace oter
 {
@@ -16,28 +19,74 @@ void Texture2D::Generate(const u32 width, const u32 height, const u8* data)
 
 void Texture2D::Generate(const Vector2<u32>& size, const u8* data)
 {
-	this->_size = size;
-
-	glBindTexture(GL_TEXTURE_2D, this->_id);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, this->_size.X, this->_size.Y, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+	this->Generate(size, TextureFormat::RGBA8, data);
+}
+
+void Texture2D::Generate(const Vector2<u32>& size, const TextureFormat format, const u8* data)
+{
+	OTTERML_PROFILE_ZONE("Texture2D::Generate");
+
+	this->_size   = size;
+	this->_format = format;
+
+	GLint  internalFormat = GL_RGBA8;
+	GLenum dataFormat     = GL_RGBA;
+	GLenum dataType       = GL_UNSIGNED_BYTE;
+	switch (format)
+	{
+	case TextureFormat::RGBA8:
+		break;
+	case TextureFormat::RGBA16F:
+		internalFormat = GL_RGBA16F;
+		break;
+	case TextureFormat::Depth24Stencil8:
+		internalFormat = GL_DEPTH24_STENCIL8;
+		dataFormat     = GL_DEPTH_STENCIL;
+		dataType       = GL_UNSIGNED_INT_24_8;
+		break;
+	case TextureFormat::Depth32F:
+		internalFormat = GL_DEPTH_COMPONENT32F;
+		dataFormat     = GL_DEPTH_COMPONENT;
+		dataType       = GL_FLOAT;
+		break;
+	}
+
+	// Delete() releases the name, so regenerating after it needs a new one
+	if (this->_id == 0)
+		glGenTextures(1, &this->_id);
+
+	GLState::BindTexture(GL_TEXTURE_2D, this->_id);
+	glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, this->_size.X, this->_size.Y, 0, dataFormat, dataType, data);
+	// Every supported data format packs a texel into 4 bytes
+	if (data != nullptr)
+		RenderStats::Add(RenderCounter::TextureBytesUploaded, static_cast<u64>(this->_size.X) * this->_size.Y * 4);
 
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 
-	glBindTexture(GL_TEXTURE_2D, 0);
+	GLState::BindTexture(GL_TEXTURE_2D, 0);
+}
+
+void Texture2D::Update(const Vector2<u32>& position, const Vector2<u32>& size, const u8* data)
+{
+	GLState::BindTexture(GL_TEXTURE_2D, this->_id);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, position.X, position.Y, size.X, size.Y, GL_RGBA, GL_UNSIGNED_BYTE, data);
+	RenderStats::Add(RenderCounter::TextureBytesUploaded, static_cast<u64>(size.X) * size.Y * 4);
+
+	GLState::BindTexture(GL_TEXTURE_2D, 0);
 }
 
 void Texture2D::Delete()
 {
-	glDeleteTextures(1, &this->_id);
+	GLState::DeleteTextures(1, &this->_id);
 	this->_id = 0;
 }
 
 void Texture2D::Bind() const
 {
-	glBindTexture(GL_TEXTURE_2D, this->_id);
+	GLState::BindTexture(GL_TEXTURE_2D, this->_id);
 }
 
 u32 Texture2D::GetID() const
@@ -45,6 +94,11 @@ u32 Texture2D::GetID() const
 	return this->_id;
 }
 
+TextureFormat Texture2D::GetFormat() const
+{
+	return this->_format;
+}
+
 const Vector2<u32>& Texture2D::GetTextureSize() const
 {
 	return this->_size;
@@ -0,0 +1,110 @@
+#include <OtterML/ThreadPool.hpp>
+
+#include <algorithm>
+
+namespace oter
+{
+
+ThreadPool::ThreadPool(u32 workerCount)
+{
+	if (workerCount == 0)
+		workerCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+
+	this->_workers.reserve(workerCount);
+	for (u32 i = 0; i < workerCount; i++)
+	{
+		this->_workers.emplace_back(&ThreadPool::WorkerLoop, this);
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard lock(this->_mutex);
+		this->_stopping = true;
+	}
+	this->_wake.notify_all();
+
+	for (std::thread& worker : this->_workers)
+	{
+		worker.join();
+	}
+}
+
+u32 ThreadPool::GetWorkerCount() const
+{
+	return static_cast<u32>(this->_workers.size());
+}
+
+void ThreadPool::ParallelFor(const u32 count, const u32 chunkSize, const Job& job)
+{
+	if (count == 0)
+		return;
+
+	const u32 chunkCount = (count + chunkSize - 1) / chunkSize;
+
+	// Not worth waking anyone up for a single chunk
+	if (chunkCount == 1 || this->_workers.empty())
+	{
+		job(0, count);
+		return;
+	}
+
+	{
+		std::lock_guard lock(this->_mutex);
+		this->_job        = &job;
+		this->_count      = count;
+		this->_chunkSize  = chunkSize;
+		this->_chunkCount = chunkCount;
+		this->_nextChunk  = 0;
+		this->_busy       = static_cast<u32>(this->_workers.size());
+		this->_generation++;
+	}
+	this->_wake.notify_all();
+
+	this->RunChunks();
+
+	// Join point: every worker has to check in before the job goes out of scope
+	std::unique_lock lock(this->_mutex);
+	this->_done.wait(lock, [this] { return this->_busy == 0; });
+	this->_job = nullptr;
+}
+
+void ThreadPool::WorkerLoop()
+{
+	u64 seenGeneration = 0;
+	while (true)
+	{
+		{
+			std::unique_lock lock(this->_mutex);
+			this->_wake.wait(lock, [this, seenGeneration] { return this->_stopping || this->_generation != seenGeneration; });
+			if (this->_stopping)
+				return;
+			seenGeneration = this->_generation;
+		}
+
+		this->RunChunks();
+
+		{
+			std::lock_guard lock(this->_mutex);
+			this->_busy--;
+		}
+		this->_done.notify_one();
+	}
+}
+
+void ThreadPool::RunChunks()
+{
+	while (true)
+	{
+		const u32 chunk = this->_nextChunk.fetch_add(1, std::memory_order_relaxed);
+		if (chunk >= this->_chunkCount)
+			return;
+
+		const u32 begin = chunk * this->_chunkSize;
+		const u32 end   = std::min(begin + this->_chunkSize, this->_count);
+		(*this->_job)(begin, end);
+	}
+}
+
+}
@@ -0,0 +1,261 @@
+#include <OtterML/Tilemap.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include <glad/gl.h>
+#include <OtterML/GLState.hpp>
+#include <OtterML/Profiler.hpp>
+#include <OtterML/RenderStats.hpp>
+#include <OtterML/Shader.hpp>
+#include <OtterML/Texture2D.hpp>
+
+namespace oter
+{
+
+Tilemap::Tilemap() {}
+
+Tilemap::~Tilemap() {}
+
+void Tilemap::Init(const Vector2<u32>& size, const Texture2D& tileset, const Vector2<f32>& tileSize)
+{
+	constexpr u32 chunkQuads = CHUNK_SIZE * CHUNK_SIZE;
+
+	// Checked here, so a bad tileset or tile size never reaches the divisions in Draw() and Rebuild()
+	const Vector2<u32>& textureSize = tileset.GetTextureSize();
+	const Vector2<u32>& frameSize   = tileset.GetFrameSize();
+	if (frameSize.X == 0 || frameSize.Y == 0 || frameSize.X > textureSize.X || frameSize.Y > textureSize.Y)
+		throw std::invalid_argument("Tilemap tileset needs a frame size that fits in its texture.");
+	if (!(tileSize.X > 0.f && tileSize.Y > 0.f) || !std::isfinite(tileSize.X) || !std::isfinite(tileSize.Y))
+		throw std::invalid_argument("Tilemap tile size must be positive.");
+
+	this->Delete();
+
+	this->_size       = size;
+	this->_chunkCount = Vector2<u32>((size.X + CHUNK_SIZE - 1) / CHUNK_SIZE, (size.Y + CHUNK_SIZE - 1) / CHUNK_SIZE);
+	this->_tileSize   = tileSize;
+	this->_tileset    = &tileset;
+	this->_columns    = textureSize.X / frameSize.X;
+	this->_frameCount = this->_columns * (textureSize.Y / frameSize.Y);
+	this->_frameUV    = Vector2<f32>(frameSize) / Vector2<f32>(textureSize);
+	this->_tiles.assign(static_cast<size_t>(size.X) * size.Y, EMPTY_TILE);
+	this->_chunks.assign(static_cast<size_t>(this->_chunkCount.X) * this->_chunkCount.Y, Chunk());
+
+	// Every chunk draws a prefix of the same quad list, so one index buffer serves them all
+	std::vector<u32> indices(static_cast<size_t>(chunkQuads) * 6);
+	for (u32 i = 0; i < chunkQuads; i++)
+	{
+		indices[i * 6 + 0] = i * 4 + 0;
+		indices[i * 6 + 1] = i * 4 + 1;
+		indices[i * 6 + 2] = i * 4 + 2;
+		indices[i * 6 + 3] = i * 4 + 2;
+		indices[i * 6 + 4] = i * 4 + 1;
+		indices[i * 6 + 5] = i * 4 + 3;
+	}
+
+	glGenBuffers(1, &this->_ibo);
+	GLState::BindVertexArray(0);
+	GLState::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->_ibo);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indices.size() * sizeof(u32)), indices.data(), GL_STATIC_DRAW);
+	RenderStats::Add(RenderCounter::BufferBytesUploaded, indices.size() * sizeof(u32));
+}
+
+void Tilemap::Delete()
+{
+	for (Chunk& chunk : this->_chunks)
+	{
+		if (chunk.vao == 0)
+			continue;
+
+		GLState::DeleteBuffers(1, &chunk.vbo);
+		GLState::DeleteVertexArrays(1, &chunk.vao);
+	}
+	GLState::DeleteBuffers(1, &this->_ibo);
+
+	this->_ibo = 0;
+	this->_tiles.clear();
+	this->_chunks.clear();
+	this->_size       = Vector2<u32>();
+	this->_chunkCount = Vector2<u32>();
+	this->_frameCount = 0;
+}
+
+void Tilemap::SetTile(const u32 x, const u32 y, const Tile tile)
+{
+	if (x >= this->_size.X || y >= this->_size.Y)
+		throw std::out_of_range("Tilemap tile is outside the map.");
+	if (tile != EMPTY_TILE && tile >= this->_frameCount)
+		throw std::out_of_range("Tilemap tile is past the last frame of the tileset.");
+
+	Tile& current = this->_tiles[static_cast<size_t>(y) * this->_size.X + x];
+	if (current == tile)
+		return;
+
+	current = tile;
+	this->GetChunk(x / CHUNK_SIZE, y / CHUNK_SIZE).dirty = true;
+}
+
+Tilemap::Tile Tilemap::GetTile(const u32 x, const u32 y) const
+{
+	if (x >= this->_size.X || y >= this->_size.Y)
+		throw std::out_of_range("Tilemap tile is outside the map.");
+
+	return this->_tiles[static_cast<size_t>(y) * this->_size.X + x];
+}
+
+void Tilemap::Fill(const Tile tile)
+{
+	if (tile != EMPTY_TILE && tile >= this->_frameCount)
+		throw std::out_of_range("Tilemap tile is past the last frame of the tileset.");
+
+	std::fill(this->_tiles.begin(), this->_tiles.end(), tile);
+	for (Chunk& chunk : this->_chunks)
+	{
+		chunk.dirty = true;
+	}
+}
+
+void Tilemap::Draw(const Shader& shader, const Vector2<f32>& viewPosition, const Vector2<f32>& viewSize)
+{
+	OTTERML_PROFILE_ZONE("Tilemap::Draw");
+
+	this->_drawCallCount     = 0;
+	this->_rebuiltChunkCount = 0;
+
+	if (this->_chunks.empty())
+		return;
+
+	// Chunks overlapping the view, clamped to the map
+	const f32 chunkWidth  = this->_tileSize.X * CHUNK_SIZE;
+	const f32 chunkHeight = this->_tileSize.Y * CHUNK_SIZE;
+	const f32 firstX      = std::floor(viewPosition.X / chunkWidth);
+	const f32 firstY      = std::floor(viewPosition.Y / chunkHeight);
+	const f32 lastX       = std::ceil((viewPosition.X + viewSize.X) / chunkWidth);
+	const f32 lastY       = std::ceil((viewPosition.Y + viewSize.Y) / chunkHeight);
+
+	const u32 beginX = static_cast<u32>(std::clamp(firstX, 0.f, static_cast<f32>(this->_chunkCount.X)));
+	const u32 beginY = static_cast<u32>(std::clamp(firstY, 0.f, static_cast<f32>(this->_chunkCount.Y)));
+	const u32 endX   = static_cast<u32>(std::clamp(lastX, 0.f, static_cast<f32>(this->_chunkCount.X)));
+	const u32 endY   = static_cast<u32>(std::clamp(lastY, 0.f, static_cast<f32>(this->_chunkCount.Y)));
+
+	if (beginX >= endX || beginY >= endY)
+		return;
+
+	shader.Use();
+	GLState::ActiveTexture(0);
+	this->_tileset->Bind();
+
+	for (u32 chunkY = beginY; chunkY < endY; chunkY++)
+	{
+		for (u32 chunkX = beginX; chunkX < endX; chunkX++)
+		{
+			Chunk& chunk = this->GetChunk(chunkX, chunkY);
+			if (chunk.dirty)
+				this->Rebuild(chunk, chunkX, chunkY);
+
+			if (chunk.quadCount == 0)
+				continue;
+
+			GLState::BindVertexArray(chunk.vao);
+			glDrawElements(GL_TRIANGLES, static_cast<i32>(chunk.quadCount * 6), GL_UNSIGNED_INT, nullptr);
+			RenderStats::AddDraw(GL_TRIANGLES, static_cast<u64>(chunk.quadCount) * 6);
+			this->_drawCallCount++;
+		}
+	}
+
+	GLState::BindVertexArray(0);
+}
+
+const Vector2<u32>& Tilemap::GetSize() const
+{
+	return this->_size;
+}
+
+Vector2<u32> Tilemap::GetChunkCount() const
+{
+	return this->_chunkCount;
+}
+
+u32 Tilemap::GetDrawCallCount() const
+{
+	return this->_drawCallCount;
+}
+
+u32 Tilemap::GetRebuiltChunkCount() const
+{
+	return this->_rebuiltChunkCount;
+}
+
+Tilemap::Chunk& Tilemap::GetChunk(const u32 x, const u32 y)
+{
+	return this->_chunks[static_cast<size_t>(y) * this->_chunkCount.X + x];
+}
+
+void Tilemap::Rebuild(Chunk& chunk, const u32 chunkX, const u32 chunkY)
+{
+	const u32 perRow   = this->_columns;
+	const f32 uvWidth  = this->_frameUV.X;
+	const f32 uvHeight = this->_frameUV.Y;
+
+	const u32 beginX = chunkX * CHUNK_SIZE;
+	const u32 beginY = chunkY * CHUNK_SIZE;
+	const u32 endX   = std::min(beginX + CHUNK_SIZE, this->_size.X);
+	const u32 endY   = std::min(beginY + CHUNK_SIZE, this->_size.Y);
+
+	this->_scratch.clear();
+	for (u32 y = beginY; y < endY; y++)
+	{
+		for (u32 x = beginX; x < endX; x++)
+		{
+			const Tile tile = this->_tiles[static_cast<size_t>(y) * this->_size.X + x];
+			if (tile == EMPTY_TILE)
+				continue;
+
+			const f32 left  = static_cast<f32>(x) * this->_tileSize.X;
+			const f32 top   = static_cast<f32>(y) * this->_tileSize.Y;
+			const f32 u     = static_cast<f32>(tile % perRow) * uvWidth;
+			const f32 v     = static_cast<f32>(tile / perRow) * uvHeight;
+			const f32 xs[4] = { left, left + this->_tileSize.X, left, left + this->_tileSize.X };
+			const f32 ys[4] = { top, top, top + this->_tileSize.Y, top + this->_tileSize.Y };
+			const f32 us[4] = { u, u + uvWidth, u, u + uvWidth };
+			const f32 vs[4] = { v, v, v + uvHeight, v + uvHeight };
+
+			for (u32 i = 0; i < 4; i++)
+			{
+				Vertex2D vertex;
+				vertex.X = xs[i];
+				vertex.Y = ys[i];
+				vertex.U = us[i];
+				vertex.V = vs[i];
+				this->_scratch.push_back(vertex);
+			}
+		}
+	}
+
+	chunk.quadCount = static_cast<u32>(this->_scratch.size() / 4);
+	chunk.dirty     = false;
+	this->_rebuiltChunkCount++;
+
+	if (chunk.quadCount == 0)
+		return;
+
+	// Chunks that were never drawn with tiles have no GL objects yet
+	if (chunk.vao == 0)
+	{
+		glGenVertexArrays(1, &chunk.vao);
+		glGenBuffers(1, &chunk.vbo);
+
+		GLState::BindVertexArray(chunk.vao);
+		GLState::BindBuffer(GL_ARRAY_BUFFER, chunk.vbo);
+		Vertex2D::SetAttributes();
+		GLState::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->_ibo);
+	}
+
+	const size_t bytes = this->_scratch.size() * sizeof(Vertex2D);
+	GLState::BindBuffer(GL_ARRAY_BUFFER, chunk.vbo);
+	glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(bytes), this->_scratch.data(), GL_STATIC_DRAW);
+	RenderStats::Add(RenderCounter::BufferBytesUploaded, bytes);
+}
+
+}
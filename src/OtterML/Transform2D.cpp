@@ -1,7 +1,7 @@
 #include <OtterML/Transform2D.hpp>
 
-#define _USE_MATH_DEFINES
-#include <cmath>
+#include <OtterML/Profiler.hpp>
+#include <OtterML/Trigonometry.hpp>
 
 namespace oter
 {
@@ -84,28 +84,53 @@ void Transform2D::Translate(const Vector2<f32>& translationChange)
 
 Matrix<f32, 3, 3>& Transform2D::GetMatrix()
 {
-	if (!this->_changed)
-		return this->_matrix;
+	if (this->_changed)
+		this->Rebuild();
 
-	const f32 radians = this->_rotation.GetRadians();
+	return this->_matrix;
+}
 
-	const f32 m00 = std::cos(radians) * this->_scale.X;
-	const f32 m01 = std::sin(radians) * this->_scale.Y;
-	const f32 m02 = static_cast<f32>(this->_translation.X);
+Matrix<f32, 3, 3>& Transform2D::GetInverseMatrix()
+{
+	if (this->_changed)
+		this->Rebuild();
 
-	const f32 m10 = -std::sin(radians) * this->_scale.X;
-	const f32 m11 = std::cos(radians) * this->_scale.Y;
-	const f32 m12 = static_cast<f32>(this->_translation.Y);
+	return this->_inverseMatrix;
+}
+
+void Transform2D::Rebuild()
+{
+	OTTERML_PROFILE_ZONE("Transform2D::Rebuild");
 
-	constexpr f32 m20 = 0.f;
-	constexpr f32 m21 = 0.f;
-	constexpr f32 m22 = 1.f;
+	f32 sine;
+	f32 cosine;
+	SinCos(this->_rotation, sine, cosine);
 
-	this->_matrix = Matrix<f32, 3, 3>(std::array{ m00, m01, m02, m10, m11, m12, m20, m21, m22 });
+	this->_matrix = Compose(sine, cosine, this->_scale.X, this->_scale.Y, this->_skew.X, this->_skew.Y,
+	                        this->_translation.X, this->_translation.Y);
 
 	this->_changed = false;
 
-	return _matrix;
+	// The rotation has determinant 1, so only scale and skew contribute
+	const f32 det = this->_scale.X * this->_scale.Y * (1.f - this->_skew.X * this->_skew.Y);
+	if (det == 0.f)
+	{
+		this->_inverseMatrix = Matrix<f32, 3, 3>::Zero;
+		return;
+	}
+
+	const std::array<f32, 9>& m      = this->_matrix.GetData();
+	const f32                 invDet = 1.f / det;
+
+	const f32 i00 = m[4] * invDet;
+	const f32 i01 = -m[1] * invDet;
+	const f32 i10 = -m[3] * invDet;
+	const f32 i11 = m[0] * invDet;
+
+	const f32 i02 = -(i00 * this->_translation.X + i01 * this->_translation.Y);
+	const f32 i12 = -(i10 * this->_translation.X + i11 * this->_translation.Y);
+
+	this->_inverseMatrix = Matrix<f32, 3, 3>(std::array{ i00, i01, i02, i10, i11, i12, 0.f, 0.f, 1.f });
 }
 
 bool Transform2D::operator==(const Transform2D& right) const
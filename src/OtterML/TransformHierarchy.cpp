@@ -0,0 +1,284 @@
+#include <OtterML/TransformHierarchy.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <OtterML/Profiler.hpp>
+
+namespace oter
+{
+
+TransformHierarchy::TransformHierarchy() {}
+
+TransformHierarchy::Node TransformHierarchy::Create(const Node parent)
+{
+	return this->Create(Transform2D(), parent);
+}
+
+TransformHierarchy::Node TransformHierarchy::Create(const Transform2D& local, const Node parent)
+{
+	const u32 parentIndex = parent == INVALID_NODE ? UINT32_MAX : this->GetIndex(parent);
+
+	Node node;
+	if (!this->_freeNodes.empty())
+	{
+		node = this->_freeNodes.back();
+		this->_freeNodes.pop_back();
+	}
+	else
+	{
+		node = static_cast<Node>(this->_indices.size());
+		this->_indices.push_back(UINT32_MAX);
+	}
+
+	// Appending keeps the parent-before-child order, since the parent already exists
+	const u32 index      = static_cast<u32>(this->_nodes.size());
+	this->_indices[node] = index;
+
+	this->_parents.push_back(parentIndex);
+	this->_locals.push_back(local);
+	this->_worlds.push_back(Matrix<f32, 3, 3>::IdentityMatrix);
+	this->_inverseWorlds.push_back(Matrix<f32, 3, 3>::IdentityMatrix);
+	this->_localDirty.push_back(false);
+	this->_worldDirty.push_back(false);
+	this->_nodes.push_back(node);
+
+	this->MarkDirty(index);
+
+	return node;
+}
+
+void TransformHierarchy::Remove(const Node node)
+{
+	const u32 root = this->GetIndex(node);
+
+	// Descendants always come after their ancestors, so one pass from the root finds the whole subtree
+	std::vector<u8> keep(this->_nodes.size(), true);
+	for (u32 i = root; i < this->_nodes.size(); i++)
+	{
+		if (i == root || (this->_parents[i] != UINT32_MAX && !keep[this->_parents[i]]))
+			keep[i] = false;
+	}
+
+	this->Compact(keep, false);
+}
+
+void TransformHierarchy::Clear()
+{
+	this->_parents.clear();
+	this->_locals.clear();
+	this->_worlds.clear();
+	this->_inverseWorlds.clear();
+	this->_localDirty.clear();
+	this->_worldDirty.clear();
+	this->_nodes.clear();
+	this->_indices.clear();
+	this->_freeNodes.clear();
+	this->_firstDirty = 0;
+}
+
+bool TransformHierarchy::IsValid(const Node node) const
+{
+	return node < this->_indices.size() && this->_indices[node] != UINT32_MAX;
+}
+
+u32 TransformHierarchy::GetCount() const
+{
+	return static_cast<u32>(this->_nodes.size());
+}
+
+TransformHierarchy::Node TransformHierarchy::GetParent(const Node node) const
+{
+	const u32 parentIndex = this->_parents[this->GetIndex(node)];
+	return parentIndex == UINT32_MAX ? INVALID_NODE : this->_nodes[parentIndex];
+}
+
+void TransformHierarchy::SetParent(const Node node, const Node parent)
+{
+	const u32 root        = this->GetIndex(node);
+	const u32 parentIndex = parent == INVALID_NODE ? UINT32_MAX : this->GetIndex(parent);
+
+	std::vector<u8> keep(this->_nodes.size(), true);
+	for (u32 i = root; i < this->_nodes.size(); i++)
+	{
+		if (i == root || (this->_parents[i] != UINT32_MAX && !keep[this->_parents[i]]))
+			keep[i] = false;
+	}
+
+	if (parentIndex != UINT32_MAX && !keep[parentIndex])
+		throw std::invalid_argument("TransformHierarchy node cannot be parented to itself or one of its descendants.");
+
+	this->_parents[root] = parentIndex;
+
+	// Move the subtree after everything else so the new parent comes first
+	if (parentIndex != UINT32_MAX && parentIndex > root)
+		this->Compact(keep, true);
+
+	this->MarkDirty(this->GetIndex(node));
+}
+
+const Transform2D& TransformHierarchy::GetLocal(const Node node) const
+{
+	return this->_locals[this->GetIndex(node)];
+}
+
+void TransformHierarchy::SetLocal(const Node node, const Transform2D& local)
+{
+	const u32 index      = this->GetIndex(node);
+	this->_locals[index] = local;
+	this->MarkDirty(index);
+}
+
+Transform2D& TransformHierarchy::EditLocal(const Node node)
+{
+	const u32 index = this->GetIndex(node);
+	this->MarkDirty(index);
+	return this->_locals[index];
+}
+
+void TransformHierarchy::Update()
+{
+	OTTERML_PROFILE_ZONE("TransformHierarchy::Update");
+
+	const u32 count = static_cast<u32>(this->_nodes.size());
+
+	for (u32 i = this->_firstDirty; i < count; i++)
+	{
+		const u32  parent = this->_parents[i];
+		const bool dirty  = this->_localDirty[i] || (parent != UINT32_MAX && this->_worldDirty[parent]);
+
+		this->_worldDirty[i] = dirty;
+		if (!dirty)
+			continue;
+
+		if (parent == UINT32_MAX)
+		{
+			this->_worlds[i]        = this->_locals[i].GetMatrix();
+			this->_inverseWorlds[i] = this->_locals[i].GetInverseMatrix();
+		}
+		else
+		{
+			this->_worlds[i]        = this->_worlds[parent] * this->_locals[i].GetMatrix();
+			this->_inverseWorlds[i] = this->_locals[i].GetInverseMatrix() * this->_inverseWorlds[parent];
+		}
+
+		this->_localDirty[i] = false;
+	}
+
+	// World-dirty flags only matter during the pass, clear them for the next one
+	for (u32 i = this->_firstDirty; i < count; i++)
+	{
+		this->_worldDirty[i] = false;
+	}
+
+	this->_firstDirty = count;
+}
+
+const Matrix<f32, 3, 3>& TransformHierarchy::GetWorldMatrix(const Node node) const
+{
+	return this->_worlds[this->GetIndex(node)];
+}
+
+const Matrix<f32, 3, 3>& TransformHierarchy::GetInverseWorldMatrix(const Node node) const
+{
+	return this->_inverseWorlds[this->GetIndex(node)];
+}
+
+u32 TransformHierarchy::GetIndex(const Node node) const
+{
+	if (!this->IsValid(node))
+		throw std::out_of_range("TransformHierarchy node does not exist.");
+
+	return this->_indices[node];
+}
+
+void TransformHierarchy::MarkDirty(const u32 index)
+{
+	this->_localDirty[index] = true;
+	this->_firstDirty        = std::min(this->_firstDirty, index);
+}
+
+void TransformHierarchy::Compact(const std::vector<u8>& keep, const bool moveDroppedToEnd)
+{
+	const u32 count = static_cast<u32>(this->_nodes.size());
+
+	std::vector<u32> order;
+	order.reserve(count);
+	for (u32 i = 0; i < count; i++)
+	{
+		if (keep[i])
+			order.push_back(i);
+	}
+	if (moveDroppedToEnd)
+	{
+		for (u32 i = 0; i < count; i++)
+		{
+			if (!keep[i])
+				order.push_back(i);
+		}
+	}
+
+	std::vector<u32> newIndex(count, UINT32_MAX);
+	for (u32 i = 0; i < order.size(); i++)
+	{
+		newIndex[order[i]] = i;
+	}
+
+	std::vector<u32>               parents;
+	std::vector<Transform2D>       locals;
+	std::vector<Matrix<f32, 3, 3>> worlds;
+	std::vector<Matrix<f32, 3, 3>> inverseWorlds;
+	std::vector<u8>                localDirty;
+	std::vector<Node>              nodes;
+	parents.reserve(order.size());
+	locals.reserve(order.size());
+	worlds.reserve(order.size());
+	inverseWorlds.reserve(order.size());
+	localDirty.reserve(order.size());
+	nodes.reserve(order.size());
+
+	for (const u32 oldIndex : order)
+	{
+		const u32 parent = this->_parents[oldIndex];
+		parents.push_back(parent == UINT32_MAX ? UINT32_MAX : newIndex[parent]);
+		locals.push_back(this->_locals[oldIndex]);
+		worlds.push_back(this->_worlds[oldIndex]);
+		inverseWorlds.push_back(this->_inverseWorlds[oldIndex]);
+		localDirty.push_back(this->_localDirty[oldIndex]);
+		nodes.push_back(this->_nodes[oldIndex]);
+	}
+
+	for (u32 i = 0; i < count; i++)
+	{
+		const Node node = this->_nodes[i];
+		if (newIndex[i] == UINT32_MAX)
+		{
+			this->_indices[node] = UINT32_MAX;
+			this->_freeNodes.push_back(node);
+		}
+		else
+		{
+			this->_indices[node] = newIndex[i];
+		}
+	}
+
+	this->_parents       = std::move(parents);
+	this->_locals        = std::move(locals);
+	this->_worlds        = std::move(worlds);
+	this->_inverseWorlds = std::move(inverseWorlds);
+	this->_localDirty    = std::move(localDirty);
+	this->_nodes         = std::move(nodes);
+	this->_worldDirty.assign(this->_nodes.size(), false);
+
+	this->_firstDirty = static_cast<u32>(this->_nodes.size());
+	for (u32 i = 0; i < this->_nodes.size(); i++)
+	{
+		if (this->_localDirty[i])
+		{
+			this->_firstDirty = i;
+			break;
+		}
+	}
+}
+
+}
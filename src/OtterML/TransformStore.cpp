@@ -0,0 +1,481 @@
+#include <OtterML/TransformStore.hpp>
+
+#include <bit>
+#include <stdexcept>
+
+#include <OtterML/Profiler.hpp>
+#include <OtterML/ThreadPool.hpp>
+#include <OtterML/Trigonometry.hpp>
+
+namespace oter
+{
+
+static f32 Lerp(const f32 from, const f32 to, const f32 alpha)
+{
+	return from + (to - from) * alpha;
+}
+
+TransformStore::TransformStore() {}
+
+TransformStore::Handle TransformStore::Create()
+{
+	return this->Create(Transform2D());
+}
+
+TransformStore::Handle TransformStore::Create(const Transform2D& transform)
+{
+	u32 slot;
+	if (!this->_freeSlots.empty())
+	{
+		slot = this->_freeSlots.back();
+		this->_freeSlots.pop_back();
+	}
+	else
+	{
+		slot = static_cast<u32>(this->_indices.size());
+		this->_indices.push_back(UINT32_MAX);
+		this->_generations.push_back(0);
+	}
+
+	const u32 index      = static_cast<u32>(this->_rotations.size());
+	this->_indices[slot] = index;
+
+	this->_rotations.push_back(transform.GetRotation().GetRadians());
+	this->_scalesX.push_back(transform.GetScale().X);
+	this->_scalesY.push_back(transform.GetScale().Y);
+	this->_skewsX.push_back(transform.GetSkew().X);
+	this->_skewsY.push_back(transform.GetSkew().Y);
+	this->_translationsX.push_back(transform.GetTranslation().X);
+	this->_translationsY.push_back(transform.GetTranslation().Y);
+	this->_matrices.push_back(Matrix<f32, 3, 3>::IdentityMatrix);
+	this->_slotOfIndex.push_back(slot);
+
+	// New transforms start out at rest, so their first interpolation does not blend in from the origin
+	this->_previousRotations.push_back(this->_rotations.back());
+	this->_previousScalesX.push_back(this->_scalesX.back());
+	this->_previousScalesY.push_back(this->_scalesY.back());
+	this->_previousSkewsX.push_back(this->_skewsX.back());
+	this->_previousSkewsY.push_back(this->_skewsY.back());
+	this->_previousTranslationsX.push_back(this->_translationsX.back());
+	this->_previousTranslationsY.push_back(this->_translationsY.back());
+	this->_renderMatrices.push_back(Matrix<f32, 3, 3>::IdentityMatrix);
+
+	if (index / 64 >= this->_dirty.size())
+		this->_dirty.push_back(0);
+	this->MarkDirty(index);
+
+	return Handle{ slot, this->_generations[slot] };
+}
+
+void TransformStore::Destroy(const Handle handle)
+{
+	const u32 index = this->GetIndex(handle);
+	const u32 last  = static_cast<u32>(this->_rotations.size()) - 1;
+
+	// Swap the last transform into the freed spot to keep the arrays dense
+	if (index != last)
+	{
+		this->_rotations[index]     = this->_rotations[last];
+		this->_scalesX[index]       = this->_scalesX[last];
+		this->_scalesY[index]       = this->_scalesY[last];
+		this->_skewsX[index]        = this->_skewsX[last];
+		this->_skewsY[index]        = this->_skewsY[last];
+		this->_translationsX[index] = this->_translationsX[last];
+		this->_translationsY[index] = this->_translationsY[last];
+		this->_matrices[index]      = this->_matrices[last];
+		this->_slotOfIndex[index]   = this->_slotOfIndex[last];
+
+		this->_previousRotations[index]     = this->_previousRotations[last];
+		this->_previousScalesX[index]       = this->_previousScalesX[last];
+		this->_previousScalesY[index]       = this->_previousScalesY[last];
+		this->_previousSkewsX[index]        = this->_previousSkewsX[last];
+		this->_previousSkewsY[index]        = this->_previousSkewsY[last];
+		this->_previousTranslationsX[index] = this->_previousTranslationsX[last];
+		this->_previousTranslationsY[index] = this->_previousTranslationsY[last];
+		this->_renderMatrices[index]        = this->_renderMatrices[last];
+
+		this->_indices[this->_slotOfIndex[index]] = index;
+
+		const u64 lastBit = 1ull << (last % 64);
+		const u64 bit     = 1ull << (index % 64);
+		if (this->_dirty[last / 64] & lastBit)
+			this->_dirty[index / 64] |= bit;
+		else
+			this->_dirty[index / 64] &= ~bit;
+	}
+
+	this->_dirty[last / 64] &= ~(1ull << (last % 64));
+
+	this->_rotations.pop_back();
+	this->_scalesX.pop_back();
+	this->_scalesY.pop_back();
+	this->_skewsX.pop_back();
+	this->_skewsY.pop_back();
+	this->_translationsX.pop_back();
+	this->_translationsY.pop_back();
+	this->_matrices.pop_back();
+	this->_slotOfIndex.pop_back();
+	this->_previousRotations.pop_back();
+	this->_previousScalesX.pop_back();
+	this->_previousScalesY.pop_back();
+	this->_previousSkewsX.pop_back();
+	this->_previousSkewsY.pop_back();
+	this->_previousTranslationsX.pop_back();
+	this->_previousTranslationsY.pop_back();
+	this->_renderMatrices.pop_back();
+	this->_dirty.resize((this->_rotations.size() + 63) / 64);
+
+	this->_indices[handle.Slot] = UINT32_MAX;
+	this->_generations[handle.Slot]++;
+	this->_freeSlots.push_back(handle.Slot);
+}
+
+void TransformStore::Clear()
+{
+	// Bump every live generation so outstanding handles become invalid
+	for (const u32 slot : this->_slotOfIndex)
+	{
+		this->_indices[slot] = UINT32_MAX;
+		this->_generations[slot]++;
+		this->_freeSlots.push_back(slot);
+	}
+
+	this->_rotations.clear();
+	this->_scalesX.clear();
+	this->_scalesY.clear();
+	this->_skewsX.clear();
+	this->_skewsY.clear();
+	this->_translationsX.clear();
+	this->_translationsY.clear();
+	this->_matrices.clear();
+	this->_slotOfIndex.clear();
+	this->_previousRotations.clear();
+	this->_previousScalesX.clear();
+	this->_previousScalesY.clear();
+	this->_previousSkewsX.clear();
+	this->_previousSkewsY.clear();
+	this->_previousTranslationsX.clear();
+	this->_previousTranslationsY.clear();
+	this->_renderMatrices.clear();
+	this->_dirty.clear();
+}
+
+void TransformStore::Reserve(const u32 capacity)
+{
+	this->_rotations.reserve(capacity);
+	this->_scalesX.reserve(capacity);
+	this->_scalesY.reserve(capacity);
+	this->_skewsX.reserve(capacity);
+	this->_skewsY.reserve(capacity);
+	this->_translationsX.reserve(capacity);
+	this->_translationsY.reserve(capacity);
+	this->_matrices.reserve(capacity);
+	this->_slotOfIndex.reserve(capacity);
+	this->_previousRotations.reserve(capacity);
+	this->_previousScalesX.reserve(capacity);
+	this->_previousScalesY.reserve(capacity);
+	this->_previousSkewsX.reserve(capacity);
+	this->_previousSkewsY.reserve(capacity);
+	this->_previousTranslationsX.reserve(capacity);
+	this->_previousTranslationsY.reserve(capacity);
+	this->_renderMatrices.reserve(capacity);
+	this->_dirty.reserve((capacity + 63) / 64);
+}
+
+bool TransformStore::IsValid(const Handle handle) const
+{
+	return handle.Slot < this->_indices.size() &&
+		this->_indices[handle.Slot] != UINT32_MAX &&
+		this->_generations[handle.Slot] == handle.Generation;
+}
+
+u32 TransformStore::GetCount() const
+{
+	return static_cast<u32>(this->_rotations.size());
+}
+
+Angle TransformStore::GetRotation(const Handle handle) const
+{
+	Angle rotation;
+	rotation.SetRadians(this->_rotations[this->GetIndex(handle)]);
+	return rotation;
+}
+
+Vector2<f32> TransformStore::GetScale(const Handle handle) const
+{
+	const u32 index = this->GetIndex(handle);
+	return Vector2<f32>(this->_scalesX[index], this->_scalesY[index]);
+}
+
+Vector2<f32> TransformStore::GetSkew(const Handle handle) const
+{
+	const u32 index = this->GetIndex(handle);
+	return Vector2<f32>(this->_skewsX[index], this->_skewsY[index]);
+}
+
+Vector2<f32> TransformStore::GetTranslation(const Handle handle) const
+{
+	const u32 index = this->GetIndex(handle);
+	return Vector2<f32>(this->_translationsX[index], this->_translationsY[index]);
+}
+
+void TransformStore::SetRotation(const Handle handle, const Angle& newRotation)
+{
+	const u32 index         = this->GetIndex(handle);
+	this->_rotations[index] = newRotation.GetRadians();
+	this->MarkDirty(index);
+}
+
+void TransformStore::SetScale(const Handle handle, const Vector2<f32>& newScale)
+{
+	const u32 index       = this->GetIndex(handle);
+	this->_scalesX[index] = newScale.X;
+	this->_scalesY[index] = newScale.Y;
+	this->MarkDirty(index);
+}
+
+void TransformStore::SetScale(const Handle handle, const f32& newScaleScalar)
+{
+	this->SetScale(handle, Vector2<f32>(newScaleScalar));
+}
+
+void TransformStore::SetSkew(const Handle handle, const Vector2<f32>& newSkew)
+{
+	const u32 index      = this->GetIndex(handle);
+	this->_skewsX[index] = newSkew.X;
+	this->_skewsY[index] = newSkew.Y;
+	this->MarkDirty(index);
+}
+
+void TransformStore::SetTranslation(const Handle handle, const Vector2<f32>& newTranslation)
+{
+	const u32 index             = this->GetIndex(handle);
+	this->_translationsX[index] = newTranslation.X;
+	this->_translationsY[index] = newTranslation.Y;
+	this->MarkDirty(index);
+}
+
+void TransformStore::Rotate(const Handle handle, const Angle& rotationChange)
+{
+	const u32 index = this->GetIndex(handle);
+	this->_rotations[index] += rotationChange.GetRadians();
+	this->MarkDirty(index);
+}
+
+void TransformStore::Scale(const Handle handle, const Vector2<f32>& scaleChange)
+{
+	const u32 index = this->GetIndex(handle);
+	this->_scalesX[index] *= scaleChange.X;
+	this->_scalesY[index] *= scaleChange.Y;
+	this->MarkDirty(index);
+}
+
+void TransformStore::Translate(const Handle handle, const Vector2<f32>& translationChange)
+{
+	const u32 index = this->GetIndex(handle);
+	this->_translationsX[index] += translationChange.X;
+	this->_translationsY[index] += translationChange.Y;
+	this->MarkDirty(index);
+}
+
+void TransformStore::RebuildDirty()
+{
+	OTTERML_PROFILE_ZONE("TransformStore::RebuildDirty");
+
+	const u32 words = static_cast<u32>(this->_dirty.size());
+	for (u32 word = 0; word < words; word++)
+	{
+		if (this->_dirty[word] != 0)
+			this->RebuildWord(word);
+	}
+}
+
+void TransformStore::RebuildDirty(ThreadPool& pool)
+{
+	OTTERML_PROFILE_ZONE("TransformStore::RebuildDirty");
+
+	// One chunk covers PARALLEL_CHUNK_SIZE / 64 bitset words, which is exactly one cache line of the bitset
+	constexpr u32 wordsPerChunk = PARALLEL_CHUNK_SIZE / 64;
+
+	pool.ParallelFor(static_cast<u32>(this->_dirty.size()), wordsPerChunk, [this](const u32 begin, const u32 end)
+	{
+		for (u32 word = begin; word < end; word++)
+		{
+			if (this->_dirty[word] != 0)
+				this->RebuildWord(word);
+		}
+	});
+}
+
+const Matrix<f32, 3, 3>& TransformStore::GetMatrix(const Handle handle) const
+{
+	return this->_matrices[this->GetIndex(handle)];
+}
+
+std::span<const Matrix<f32, 3, 3>> TransformStore::GetMatrices() const
+{
+	return this->_matrices;
+}
+
+void TransformStore::SaveState()
+{
+	this->_previousRotations     = this->_rotations;
+	this->_previousScalesX       = this->_scalesX;
+	this->_previousScalesY       = this->_scalesY;
+	this->_previousSkewsX        = this->_skewsX;
+	this->_previousSkewsY        = this->_skewsY;
+	this->_previousTranslationsX = this->_translationsX;
+	this->_previousTranslationsY = this->_translationsY;
+}
+
+void TransformStore::ResetInterpolation(const Handle handle)
+{
+	const u32 index = this->GetIndex(handle);
+
+	this->_previousRotations[index]     = this->_rotations[index];
+	this->_previousScalesX[index]       = this->_scalesX[index];
+	this->_previousScalesY[index]       = this->_scalesY[index];
+	this->_previousSkewsX[index]        = this->_skewsX[index];
+	this->_previousSkewsY[index]        = this->_skewsY[index];
+	this->_previousTranslationsX[index] = this->_translationsX[index];
+	this->_previousTranslationsY[index] = this->_translationsY[index];
+}
+
+void TransformStore::Interpolate(const f32 alpha)
+{
+	OTTERML_PROFILE_ZONE("TransformStore::Interpolate");
+
+	const size_t count = this->_rotations.size();
+
+	this->_blendRotations.resize(count);
+	this->_blendSines.resize(count);
+	this->_blendCosines.resize(count);
+
+	this->InterpolateRange(alpha, 0, static_cast<u32>(count));
+}
+
+void TransformStore::Interpolate(const f32 alpha, ThreadPool& pool)
+{
+	OTTERML_PROFILE_ZONE("TransformStore::Interpolate");
+
+	const size_t count = this->_rotations.size();
+
+	this->_blendRotations.resize(count);
+	this->_blendSines.resize(count);
+	this->_blendCosines.resize(count);
+
+	pool.ParallelFor(static_cast<u32>(count), PARALLEL_CHUNK_SIZE, [this, alpha](const u32 begin, const u32 end)
+	{
+		this->InterpolateRange(alpha, begin, end);
+	});
+}
+
+const Matrix<f32, 3, 3>& TransformStore::GetRenderMatrix(const Handle handle) const
+{
+	return this->_renderMatrices[this->GetIndex(handle)];
+}
+
+std::span<const Matrix<f32, 3, 3>> TransformStore::GetRenderMatrices() const
+{
+	return this->_renderMatrices;
+}
+
+u32 TransformStore::GetIndex(const Handle handle) const
+{
+	if (!this->IsValid(handle))
+		throw std::out_of_range("TransformStore handle is stale or does not exist.");
+
+	return this->_indices[handle.Slot];
+}
+
+void TransformStore::MarkDirty(const u32 index)
+{
+	this->_dirty[index / 64] |= 1ull << (index % 64);
+}
+
+void TransformStore::InterpolateRange(const f32 alpha, const u32 begin, const u32 end)
+{
+	const f32* previous = this->_previousRotations.data();
+	const f32* current  = this->_rotations.data();
+	f32*       blended  = this->_blendRotations.data();
+	for (u32 i = begin; i < end; i++)
+	{
+		// Wrap the difference into [-pi, pi] so rotations blend along the shortest arc
+		constexpr f32 turn       = static_cast<f32>(2.0 * PI);
+		constexpr f32 roundMagic = 12582912.f;
+
+		f32 delta = current[i] - previous[i];
+		delta -= turn * ((delta * (1.f / turn) + roundMagic) - roundMagic);
+
+		blended[i] = previous[i] + delta * alpha;
+	}
+
+	const u32 count = end - begin;
+	SinCos(std::span<const f32>(this->_blendRotations.data() + begin, count),
+	       std::span<f32>(this->_blendSines.data() + begin, count),
+	       std::span<f32>(this->_blendCosines.data() + begin, count));
+
+	for (u32 i = begin; i < end; i++)
+	{
+		this->_renderMatrices[i] = Transform2D::Compose(
+			this->_blendSines[i], this->_blendCosines[i],
+			Lerp(this->_previousScalesX[i], this->_scalesX[i], alpha),
+			Lerp(this->_previousScalesY[i], this->_scalesY[i], alpha),
+			Lerp(this->_previousSkewsX[i], this->_skewsX[i], alpha),
+			Lerp(this->_previousSkewsY[i], this->_skewsY[i], alpha),
+			Lerp(this->_previousTranslationsX[i], this->_translationsX[i], alpha),
+			Lerp(this->_previousTranslationsY[i], this->_translationsY[i], alpha)
+		);
+	}
+}
+
+void TransformStore::RebuildWord(const u32 word)
+{
+	u64       bits  = this->_dirty[word];
+	const u32 first = word * 64;
+
+	// Gather the dirty rotations so SinCos runs as one contiguous vectorized batch
+	u32 indices[64];
+	f32 radians[64];
+	f32 sines[64];
+	f32 cosines[64];
+
+	u32 count = 0;
+	if (bits == UINT64_MAX)
+	{
+		for (u32 i = 0; i < 64; i++)
+		{
+			indices[i] = first + i;
+		}
+		count = 64;
+		SinCos(std::span<const f32>(this->_rotations.data() + first, 64), sines, cosines);
+	}
+	else
+	{
+		while (bits != 0)
+		{
+			const u32 index   = first + static_cast<u32>(std::countr_zero(bits));
+			indices[count]    = index;
+			radians[count]    = this->_rotations[index];
+			count++;
+			bits &= bits - 1;
+		}
+		SinCos(std::span<const f32>(radians, count), sines, cosines);
+	}
+
+	for (u32 i = 0; i < count; i++)
+	{
+		const u32 index = indices[i];
+
+		this->_matrices[index] = Transform2D::Compose(
+			sines[i], cosines[i],
+			this->_scalesX[index], this->_scalesY[index],
+			this->_skewsX[index], this->_skewsY[index],
+			this->_translationsX[index], this->_translationsY[index]
+		);
+	}
+
+	this->_dirty[word] = 0;
+}
+
+}
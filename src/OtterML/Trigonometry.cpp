@@ -0,0 +1,50 @@
+#include <OtterML/Trigonometry.hpp>
+
+#include <stdexcept>
+
+namespace oter
+{
+
+template <TrigPrecision P>
+static void SinCosBatch(const f32* radians, f32* sinOut, f32* cosOut, const size_t count)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		SinCosKernel<P>(radians[i], sinOut[i], cosOut[i]);
+	}
+}
+
+template <TrigPrecision P>
+static void SinCosBatch(const Angle* angles, f32* sinOut, f32* cosOut, const size_t count)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		SinCosKernel<P>(angles[i].GetRadians(), sinOut[i], cosOut[i]);
+	}
+}
+
+void SinCos(const std::span<const f32> radians, const std::span<f32> sinOut, const std::span<f32> cosOut,
+            const TrigPrecision precision)
+{
+	if (sinOut.size() < radians.size() || cosOut.size() < radians.size())
+		throw std::out_of_range("SinCos output spans must be at least as long as the input.");
+
+	if (precision == TrigPrecision::Fast)
+		SinCosBatch<TrigPrecision::Fast>(radians.data(), sinOut.data(), cosOut.data(), radians.size());
+	else
+		SinCosBatch<TrigPrecision::Precise>(radians.data(), sinOut.data(), cosOut.data(), radians.size());
+}
+
+void SinCos(const std::span<const Angle> angles, const std::span<f32> sinOut, const std::span<f32> cosOut,
+            const TrigPrecision precision)
+{
+	if (sinOut.size() < angles.size() || cosOut.size() < angles.size())
+		throw std::out_of_range("SinCos output spans must be at least as long as the input.");
+
+	if (precision == TrigPrecision::Fast)
+		SinCosBatch<TrigPrecision::Fast>(angles.data(), sinOut.data(), cosOut.data(), angles.size());
+	else
+		SinCosBatch<TrigPrecision::Precise>(angles.data(), sinOut.data(), cosOut.data(), angles.size());
+}
+
+}
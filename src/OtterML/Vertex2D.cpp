@@ -0,0 +1,20 @@
+#include <OtterML/Vertex2D.hpp>
+
+#include <cstddef>
+
+#include <glad/gl.h>
+
+namespace oter
+{
+
+void Vertex2D::SetAttributes()
+{
+	glEnableVertexAttribArray(0);
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex2D), reinterpret_cast<void*>(offsetof(Vertex2D, X)));
+	glEnableVertexAttribArray(1);
+	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex2D), reinterpret_cast<void*>(offsetof(Vertex2D, U)));
+	glEnableVertexAttribArray(2);
+	glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex2D), reinterpret_cast<void*>(offsetof(Vertex2D, Tint)));
+}
+
+}
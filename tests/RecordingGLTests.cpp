@@ -0,0 +1,430 @@
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include <glad/gl.h>
+#include <OtterML/Font.hpp>
+#include <OtterML/GLState.hpp>
+#include <OtterML/GlyphAtlas.hpp>
+#include <OtterML/RecordingGL.hpp>
+#include <OtterML/RenderStats.hpp>
+#include <OtterML/Shader.hpp>
+#include <OtterML/ShapeBatch.hpp>
+#include <OtterML/SpriteBatch.hpp>
+#include <OtterML/StaticGeometry.hpp>
+#include <OtterML/StreamBuffer.hpp>
+#include <OtterML/TextRenderer.hpp>
+#include <OtterML/Texture2D.hpp>
+#include <OtterML/Tilemap.hpp>
+#include <OtterML/Transform2D.hpp>
+
+using namespace oter;
+
+static u32 failures = 0;
+
+#define CHECK_EQUAL(actual, expected)                                                                     \
+	do                                                                                                    \
+	{                                                                                                     \
+		const auto a = (actual);                                                                          \
+		const auto e = (expected);                                                                        \
+		if (a != e)                                                                                       \
+		{                                                                                                 \
+			std::printf("%s:%d: %s is %llu, expected %llu\n", __FILE__, __LINE__, #actual,                \
+			            static_cast<unsigned long long>(a), static_cast<unsigned long long>(e));         \
+			failures++;                                                                                   \
+		}                                                                                                 \
+	} while (false)
+
+// TrueType font of 27 identical 400x600 boxes, with 'a' to 'z' mapped to glyphs 1 to 26 and everything else to the
+// missing glyph. Ascender to descender is 1000 units, so a glyph is 0.4 by 0.6 of the pixel height
+static std::vector<u8> MakeTestFont()
+{
+	constexpr u32 glyphCount = 27;
+
+	const auto put16 = [](std::vector<u8>& out, const u32 value)
+	{
+		out.push_back(static_cast<u8>(value >> 8));
+		out.push_back(static_cast<u8>(value));
+	};
+	const auto put32 = [&](std::vector<u8>& out, const u32 value)
+	{
+		put16(out, value >> 16);
+		put16(out, value);
+	};
+
+	std::vector<u8> head(54, 0);
+	std::vector<u8> hhea(36, 0);
+	hhea[4]  = 800 >> 8;
+	hhea[5]  = 800 & 0xFF;
+	hhea[6]  = static_cast<u8>(-200 >> 8);
+	hhea[7]  = static_cast<u8>(-200 & 0xFF);
+	hhea[35] = glyphCount;
+
+	std::vector<u8> maxp;
+	put32(maxp, 0x00005000);
+	put16(maxp, glyphCount);
+
+	// Format 4 with one segment for 'a' to 'z' and the closing 0xFFFF segment
+	std::vector<u8> cmap;
+	put16(cmap, 0);
+	put16(cmap, 1);
+	put16(cmap, 3);
+	put16(cmap, 1);
+	put32(cmap, 12);
+	for (const u32 value : { 4u, 32u, 0u, 4u, 2u, 0u, 0u, 'z' * 1u, 0xFFFFu, 0u, 'a' * 1u, 0xFFFFu, 1u - 'a', 1u, 0u, 0u })
+	{
+		put16(cmap, value);
+	}
+
+	std::vector<u8> hmtx;
+	std::vector<u8> loca;
+	std::vector<u8> glyf;
+	for (u32 glyph = 0; glyph < glyphCount; glyph++)
+	{
+		put16(hmtx, 600);
+		put16(hmtx, 100);
+		put16(loca, static_cast<u32>(glyf.size() / 2));
+		for (const u32 value : { 1u, 100u, 0u, 500u, 600u, 3u, 0u })
+		{
+			put16(glyf, value);
+		}
+		glyf.insert(glyf.end(), 4, 0x01);
+		for (const u32 value : { 100u, 0u, 400u, 0u, 0u, 600u, 0u, static_cast<u32>(-600) })
+		{
+			put16(glyf, value);
+		}
+	}
+	put16(loca, static_cast<u32>(glyf.size() / 2));
+
+	const std::pair<const char*, const std::vector<u8>*> tables[] = {
+		{ "cmap", &cmap }, { "glyf", &glyf }, { "head", &head }, { "hhea", &hhea },
+		{ "hmtx", &hmtx }, { "loca", &loca }, { "maxp", &maxp },
+	};
+
+	std::vector<u8> font;
+	put32(font, 0x00010000);
+	put16(font, 7);
+	font.resize(12, 0);
+
+	u32 offset = 12 + 7 * 16;
+	for (const auto& [tag, table] : tables)
+	{
+		font.insert(font.end(), tag, tag + 4);
+		put32(font, 0);
+		put32(font, offset);
+		put32(font, static_cast<u32>(table->size()));
+		offset += static_cast<u32>(table->size() + 3) & ~3u;
+	}
+	for (const auto& [tag, table] : tables)
+	{
+		font.insert(font.end(), table->begin(), table->end());
+		font.resize((font.size() + 3) & ~static_cast<size_t>(3), 0);
+	}
+	return font;
+}
+
+static void SpriteBatchDrawsOncePerTextureRun()
+{
+	RecordingGL::Install(4, 1);
+
+	Shader shader;
+	shader.Compile(SpriteBatch::VERTEX_SOURCE, "", SpriteBatch::FRAGMENT_SOURCE);
+	Texture2D first;
+	Texture2D second;
+	first.Generate(Vector2<u32>(4u), nullptr);
+	second.Generate(Vector2<u32>(4u), nullptr);
+
+	SpriteBatch batch;
+	batch.Init();
+	Transform2D transform;
+
+	// Sorted by texture, alternating sprites collapse into one run per texture
+	RecordingGL::Clear();
+	batch.Begin();
+	for (u32 i = 0; i < 100; i++)
+	{
+		batch.Draw(i % 2 ? second : first, shader, transform.GetMatrix(), Vector2<f32>(1.f), Vector2<f32>(0.f),
+		           Vector2<f32>(1.f));
+	}
+	batch.End();
+	CHECK_EQUAL(RecordingGL::GetCallCount("glDrawElementsBaseVertex"), 2u);
+	CHECK_EQUAL(batch.GetBatchCount(), 2u);
+
+	// In submission order, every texture change starts a new run
+	RecordingGL::Clear();
+	batch.Begin(SpriteSortMode::Submission);
+	for (u32 i = 0; i < 6; i++)
+	{
+		batch.Draw(i / 2 % 2 ? second : first, shader, transform.GetMatrix(), Vector2<f32>(1.f), Vector2<f32>(0.f),
+		           Vector2<f32>(1.f));
+	}
+	batch.End();
+	CHECK_EQUAL(RecordingGL::GetCallCount("glDrawElementsBaseVertex"), 3u);
+
+	batch.Delete();
+}
+
+static void StaticGeometryUsesOneMultiDraw()
+{
+	RecordingGL::Install(4, 6);
+
+	Shader shader;
+	shader.Compile(SpriteBatch::VERTEX_SOURCE, "", SpriteBatch::FRAGMENT_SOURCE);
+	Texture2D texture;
+	texture.Generate(Vector2<u32>(4u), nullptr);
+
+	const Vertex2D vertices[4] = {};
+	const u32      indices[6]  = { 0, 1, 2, 2, 1, 3 };
+
+	StaticGeometry geometry;
+	geometry.Init();
+	for (u32 i = 0; i < 50; i++)
+	{
+		geometry.Add(vertices, indices);
+	}
+	geometry.SetVisible(7, false);
+
+	RenderStats::Reset();
+	RecordingGL::Clear();
+	geometry.Draw(texture, shader);
+	CHECK_EQUAL(RecordingGL::GetCallCount("glMultiDrawElementsIndirect"), 1u);
+	CHECK_EQUAL(RecordingGL::GetCallCount("glDrawElementsIndirect"), 0u);
+	CHECK_EQUAL(geometry.GetDrawCallCount(), 1u);
+	CHECK_EQUAL(RenderStats::GetCurrent(RenderCounter::DrawCalls), 1u);
+	CHECK_EQUAL(RenderStats::GetCurrent(RenderCounter::Triangles), 49u * 2);
+
+	geometry.Delete();
+}
+
+static void GLStateSkipsRedundantBinds()
+{
+	RecordingGL::Install(4, 1);
+	GLState::ResetCounters();
+
+	for (u32 i = 0; i < 3; i++)
+	{
+		GLState::UseProgram(3);
+		GLState::ActiveTexture(0);
+		GLState::BindTexture(GL_TEXTURE_2D, 5);
+		GLState::BindBuffer(GL_ARRAY_BUFFER, 7);
+		GLState::BindVertexArray(9);
+	}
+	GLState::BindTexture(GL_TEXTURE_2D, 6);
+
+	CHECK_EQUAL(RecordingGL::GetCallCount("glUseProgram"), 1u);
+	CHECK_EQUAL(RecordingGL::GetCallCount("glActiveTexture"), 1u);
+	CHECK_EQUAL(RecordingGL::GetCallCount("glBindTexture"), 2u);
+	CHECK_EQUAL(RecordingGL::GetCallCount("glBindBuffer"), 1u);
+	CHECK_EQUAL(RecordingGL::GetCallCount("glBindVertexArray"), 1u);
+	CHECK_EQUAL(GLState::GetCounters().GetSkippedCount(), 10u);
+
+	// After invalidating, the same bind has to reach GL again
+	GLState::Invalidate();
+	GLState::UseProgram(3);
+	CHECK_EQUAL(RecordingGL::GetCallCount("glUseProgram"), 2u);
+}
+
+static void StreamBufferWritesReachStorage(const u32 minorVersion)
+{
+	RecordingGL::Install(4, minorVersion);
+
+	// 4.4 and later map the buffer persistently, earlier versions orphan and map each write
+	StreamBuffer stream;
+	stream.Init(GL_ARRAY_BUFFER, 64);
+	CHECK_EQUAL(stream.IsPersistent(), minorVersion >= 4);
+
+	std::vector<u8> data(48);
+	for (u32 round = 0; round < 8; round++)
+	{
+		for (size_t i = 0; i < data.size(); i++)
+		{
+			data[i] = static_cast<u8>(round * 31 + i);
+		}
+
+		const u32                 offset   = stream.Write(data.data(), static_cast<u32>(data.size()));
+		const std::span<const u8> contents = RecordingGL::GetBufferContents(stream.GetID());
+		CHECK_EQUAL(contents.size() >= offset + data.size(), true);
+		if (contents.size() >= offset + data.size())
+			CHECK_EQUAL(std::memcmp(contents.data() + offset, data.data(), data.size()), 0);
+	}
+
+	stream.Delete();
+}
+
+static void TilemapDrawsOncePerVisibleChunk()
+{
+	RecordingGL::Install(4, 1);
+
+	Shader shader;
+	shader.Compile(SpriteBatch::VERTEX_SOURCE, "", SpriteBatch::FRAGMENT_SOURCE);
+	Texture2D tileset;
+	tileset.Generate(Vector2<u32>(64u), nullptr);
+
+	// Without a frame size the tileset cannot be split into tiles, which Init() must catch before Draw() divides by it
+	Tilemap tilemap;
+	bool    threw = false;
+	try
+	{
+		tilemap.Init(Vector2<u32>(2048u), tileset, Vector2<f32>(8.f));
+	}
+	catch (const std::invalid_argument&)
+	{
+		threw = true;
+	}
+	CHECK_EQUAL(threw, true);
+
+	tileset.SetFrameSize(Vector2<u32>(8u));
+	tilemap.Init(Vector2<u32>(2048u), tileset, Vector2<f32>(8.f));
+	tilemap.Fill(0);
+
+	// Chunks are 256 pixels wide, so a 1920x1080 view covers 8 by 5 of them
+	RecordingGL::Clear();
+	tilemap.Draw(shader, Vector2<f32>(0.f), Vector2<f32>(1920.f, 1080.f));
+	CHECK_EQUAL(RecordingGL::GetCallCount("glDrawElements"), 40u);
+	CHECK_EQUAL(tilemap.GetDrawCallCount(), 40u);
+	CHECK_EQUAL(tilemap.GetRebuiltChunkCount(), 40u);
+
+	// Only the chunk holding a changed tile is rebuilt
+	tilemap.SetTile(100, 50, 5);
+	RecordingGL::Clear();
+	tilemap.Draw(shader, Vector2<f32>(0.f), Vector2<f32>(1920.f, 1080.f));
+	CHECK_EQUAL(RecordingGL::GetCallCount("glDrawElements"), 40u);
+	CHECK_EQUAL(tilemap.GetRebuiltChunkCount(), 1u);
+
+	tilemap.Delete();
+}
+
+static void TextRendererReusesStaticRuns()
+{
+	RecordingGL::Install(4, 1);
+
+	Shader shader;
+	shader.Compile(SpriteBatch::VERTEX_SOURCE, "", SpriteBatch::FRAGMENT_SOURCE);
+	Font font;
+	font.LoadFromMemory(MakeTestFont());
+
+	GlyphAtlas atlas;
+	atlas.Init(Vector2<u32>(256u));
+	TextRenderer text;
+	text.Init(atlas);
+	SpriteBatch batch;
+	batch.Init();
+
+	// "static text" has 8 distinct glyphs. After the first frame it is neither laid out nor uploaded again
+	for (u32 frame = 0; frame < 4; frame++)
+	{
+		RecordingGL::Clear();
+		batch.Begin();
+		text.Draw(batch, shader, font, "static text", 20, Vector2<f32>(10.f));
+		batch.End();
+		CHECK_EQUAL(text.GetLayoutCount(), frame == 0 ? 1u : 0u);
+		CHECK_EQUAL(RecordingGL::GetCallCount("glTexSubImage2D"), frame == 0 ? 8u : 0u);
+		CHECK_EQUAL(RecordingGL::GetCallCount("glDrawElementsBaseVertex"), 1u);
+		text.EndFrame();
+	}
+	CHECK_EQUAL(text.GetCachedRunCount(), 1u);
+
+	batch.Delete();
+	atlas.Delete();
+}
+
+static void GlyphAtlasWaitsForEndFrameWhenFull()
+{
+	RecordingGL::Install(4, 1);
+
+	Shader shader;
+	shader.Compile(SpriteBatch::VERTEX_SOURCE, "", SpriteBatch::FRAGMENT_SOURCE);
+	Font font;
+	font.LoadFromMemory(MakeTestFont());
+
+	// At 40 pixels a glyph is 16x24, so a 64x64 atlas holds two shelves of three
+	GlyphAtlas atlas;
+	atlas.Init(Vector2<u32>(64u));
+	TextRenderer text;
+	text.Init(atlas);
+	SpriteBatch batch;
+	batch.Init();
+
+	const u32 generation = atlas.GetGeneration();
+	RecordingGL::Clear();
+	batch.Begin();
+	text.Draw(batch, shader, font, "ab", 40, Vector2<f32>(0.f));
+	text.Draw(batch, shader, font, "abcdefghij", 40, Vector2<f32>(0.f, 50.f));
+	batch.End();
+
+	// Glyphs that did not fit are left out, and the ones already placed keep their texels for the rest of the frame
+	CHECK_EQUAL(atlas.IsFull(), true);
+	CHECK_EQUAL(atlas.GetGlyphCount(), 6u);
+	CHECK_EQUAL(atlas.GetGeneration(), generation);
+	CHECK_EQUAL(RecordingGL::GetCallCount("glTexSubImage2D"), 6u);
+
+	text.EndFrame();
+	CHECK_EQUAL(atlas.IsFull(), false);
+	CHECK_EQUAL(atlas.GetGlyphCount(), 0u);
+	CHECK_EQUAL(atlas.GetGeneration(), generation + 1);
+
+	// The cached run was built from the old generation, so it is laid out again
+	batch.Begin();
+	text.Draw(batch, shader, font, "ab", 40, Vector2<f32>(0.f));
+	batch.End();
+	CHECK_EQUAL(text.GetLayoutCount(), 1u);
+	CHECK_EQUAL(atlas.GetGlyphCount(), 2u);
+	CHECK_EQUAL(atlas.IsFull(), false);
+
+	batch.Delete();
+	atlas.Delete();
+}
+
+static void ShapeBatchDrawsOncePerPrimitiveType()
+{
+	RecordingGL::Install(4, 6);
+
+	Shader shader;
+	shader.Compile(SpriteBatch::VERTEX_SOURCE, "", ShapeBatch::FRAGMENT_SOURCE);
+	ShapeBatch shapes;
+	shapes.Init();
+
+	// Each round adds 1 + 4 + 16 lines and 2 + 16 triangles
+	RecordingGL::Clear();
+	shapes.Begin();
+	for (u32 i = 0; i < 5000; i++)
+	{
+		const Vector2<f32> position = Vector2<f32>(static_cast<f32>(i % 100), static_cast<f32>(i / 100));
+		shapes.Line(position, position + Vector2<f32>(5.f), Color(0xFF, 0x00, 0x00));
+		shapes.Rect(position, Vector2<f32>(4.f), Color(0x00, 0xFF, 0x00));
+		shapes.Rect(position, Vector2<f32>(4.f), Color(0x00, 0x00, 0xFF), true);
+		shapes.Circle(position, 3.f, Color(0xFF, 0xFF, 0x00), true, 16);
+		shapes.Circle(position, 3.f, Color(0xFF, 0x00, 0xFF), false, 16);
+	}
+	shapes.End(shader);
+
+	CHECK_EQUAL(RecordingGL::GetCallCount("glDrawArrays"), 2u);
+	CHECK_EQUAL(shapes.GetDrawCallCount(), 2u);
+	CHECK_EQUAL(shapes.GetLineCount(), 5000u * 21);
+	CHECK_EQUAL(shapes.GetTriangleCount(), 5000u * 18);
+
+	shapes.Delete();
+}
+
+int main()
+{
+	SpriteBatchDrawsOncePerTextureRun();
+	StaticGeometryUsesOneMultiDraw();
+	GLStateSkipsRedundantBinds();
+	StreamBufferWritesReachStorage(1);
+	StreamBufferWritesReachStorage(6);
+	TilemapDrawsOncePerVisibleChunk();
+	TextRendererReusesStaticRuns();
+	GlyphAtlasWaitsForEndFrameWhenFull();
+	ShapeBatchDrawsOncePerPrimitiveType();
+
+	if (failures != 0)
+	{
+		std::printf("%u checks failed\n", failures);
+		return 1;
+	}
+
+	std::printf("All checks passed\n");
+	return 0;
+}